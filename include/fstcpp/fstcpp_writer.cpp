@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <cstring>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -78,6 +79,7 @@ void Writer::close() {
 		m_header_.m_start_time = 0;
 	}
 	flushValueChangeData_(m_value_change_data_, m_main_fst_file_);
+	drainPendingBlocks_(m_main_fst_file_);
 	appendGeometry_(m_main_fst_file_);
 	appendHierarchy_(m_main_fst_file_);
 	appendBlackout_(m_main_fst_file_);
@@ -653,8 +655,58 @@ void detail::ValueChangeData::writeTimestamps(std::vector<uint8_t> &os) const {
 	}
 }
 
-void Writer::flushValueChangeDataConstPart_(
-	const detail::ValueChangeData &vcd, std::ostream &os, WriterPackType pack_type
+void Writer::flushValueChangeData_(detail::ValueChangeData &vcd, std::ostream &os) {
+	if (vcd.m_timestamps.empty()) {
+		return;
+	}
+	detail::ValueChangeBlock block{captureValueChangeBlock_(vcd)};
+	vcd.keepOnlyTheLatestValue();
+	++m_header_.m_num_value_change_data_blocks;
+	m_value_change_data_usage_ = 0;
+	m_flush_pending_ = false;
+
+	if (m_max_pending_blocks_ == 0) {
+		writeValueChangeBlock_(block, os, m_pack_type_);
+		return;
+	}
+	// Bound the memory: wait for the oldest block before starting a new one
+	if (m_pending_blocks_.size() >= m_max_pending_blocks_) {
+		writeOldestPendingBlock_(os);
+	}
+	const WriterPackType pack_type{m_pack_type_};
+	m_pending_blocks_.emplace_back(std::async(
+		std::launch::async,
+		[pack_type](detail::ValueChangeBlock &&blk) {
+			std::ostringstream block_os{std::ios::binary};
+			writeValueChangeBlock_(blk, block_os, pack_type);
+			return block_os.str();
+		},
+		std::move(block)
+	));
+}
+
+void Writer::writeOldestPendingBlock_(std::ostream &os) {
+	FST_CHECK(!m_pending_blocks_.empty());
+	// Blocks are written in the order they were captured
+	const std::string data{m_pending_blocks_.front().get()};
+	m_pending_blocks_.pop_front();
+	os.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+detail::ValueChangeBlock Writer::captureValueChangeBlock_(const detail::ValueChangeData &vcd) {
+	detail::ValueChangeBlock block{};
+	block.m_start_time = vcd.m_timestamps.front();
+	block.m_end_time = vcd.m_timestamps.back();
+	block.m_num_timestamps = vcd.m_timestamps.size();
+	block.m_num_variables = vcd.m_variable_infos.size();
+	vcd.writeInitialBits(block.m_bits_data);
+	block.m_wave_data = vcd.computeWaveData();
+	vcd.writeTimestamps(block.m_time_data);
+	return block;
+}
+
+void Writer::writeValueChangeBlock_(
+	detail::ValueChangeBlock &block, std::ostream &os, WriterPackType pack_type
 ) {
 	// 0. setup
 	StreamWriteHelper h(os);
@@ -667,8 +719,8 @@ void Writer::flushValueChangeDataConstPart_(
 		h                            //
 			.beginOffset(start_pos)  // record start position
 			.writeBlockHeader(BlockType::WAVE_DATA_VERSION3, 0 /* Length placeholder 0 */)
-			.writeUInt(vcd.m_timestamps.front())
-			.writeUInt(vcd.m_timestamps.back())
+			.writeUInt(block.m_start_time)
+			.writeUInt(block.m_end_time)
 			.beginOffset(memory_usage_pos)  // record memory usage position
 			.writeUInt<uint64_t>(0);        // placeholder for memory usage
 		return std::make_pair(start_pos, memory_usage_pos);
@@ -678,8 +730,7 @@ void Writer::flushValueChangeDataConstPart_(
 
 	// 2. Bits Section
 	{
-		std::vector<uint8_t> bits_data;
-		vcd.writeInitialBits(bits_data);
+		const std::vector<uint8_t> &bits_data = block.m_bits_data;
 		std::vector<uint8_t> bits_data_compressed;
 		const uint8_t *selected_data;
 		size_t selected_size;
@@ -697,26 +748,26 @@ void Writer::flushValueChangeDataConstPart_(
 		h                                              //
 			.writeLEB128(bits_data.size())             // uncompressed length
 			.writeLEB128(selected_size)                // compressed length
-			.writeLEB128(vcd.m_variable_infos.size())  // bits count
+			.writeLEB128(block.m_num_variables)        // bits count
 			.write(selected_data, selected_size);
 	}
 
 	// 3. Waves Section
 	// Note: We need positions for the next section
 	const auto p_tmp2 = [&, pack_type]() {
-		std::vector<std::vector<uint8_t>> wave_data{vcd.computeWaveData()};
+		std::vector<std::vector<uint8_t>> &wave_data = block.m_wave_data;
 		const size_t memory_usage{std::accumulate(
 			wave_data.begin(),
 			wave_data.end(),
 			size_t(0),
 			[](size_t a, const std::vector<uint8_t> &b) { return a + b.size(); }
 		)};
-		std::vector<int64_t> positions{vcd.uniquifyWaveData(wave_data)};
+		std::vector<int64_t> positions{detail::ValueChangeData::uniquifyWaveData(wave_data)};
 		h
 			// Note: this is not a typo, I expect we shall write count here.
 			// but the spec indeed write vcd.variable_infos.size(),
 			// which is repeated 1 times in header block, 2 times in valuechange block
-			.writeLEB128(vcd.m_variable_infos.size())
+			.writeLEB128(block.m_num_variables)
 			.writeUInt(uint8_t('4'));
 		const uint64_t count{detail::ValueChangeData::encodePositionsAndwriteUniqueWaveData(
 			os, wave_data, positions, pack_type
@@ -730,15 +781,14 @@ void Writer::flushValueChangeDataConstPart_(
 	// 4. Position Section
 	{
 		const std::streampos pos_begin{os.tellp()};
-		vcd.writeEncodedPositions(positions, os);
+		detail::ValueChangeData::writeEncodedPositions(positions, os);
 		const uint64_t pos_size{static_cast<uint64_t>(os.tellp() - pos_begin)};
 		h.writeUInt(pos_size);  // Length comes AFTER data for positions
 	}
 
 	// 5. Time Section
 	{
-		std::vector<uint8_t> time_data;
-		vcd.writeTimestamps(time_data);
+		const std::vector<uint8_t> &time_data = block.m_time_data;
 		std::vector<uint8_t> time_data_compressed;
 		const uint8_t *selected_data;
 		size_t selected_size;
@@ -756,7 +806,7 @@ void Writer::flushValueChangeDataConstPart_(
 			.write(selected_data, selected_size)            // time data
 			.writeUInt(time_data.size())                    // uncompressed len
 			.writeUInt(selected_size)                       // compressed len
-			.writeUInt(uint64_t(vcd.m_timestamps.size()));  // count
+			.writeUInt(block.m_num_timestamps);             // count
 	}
 
 	// 6. Patch Block Length and Memory Required
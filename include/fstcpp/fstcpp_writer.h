@@ -11,7 +11,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <ctime>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <string>
 #include <vector>
 #if __cplusplus >= 201703L
 #	include <string_view>
@@ -61,6 +64,19 @@ struct ValueChangeData {
 	void keepOnlyTheLatestValue();
 };
 
+// Raw (not yet compressed) content of one value change block.
+// It is captured from ValueChangeData on the calling thread, and is self-contained
+// so that the compression and encoding can be done on another thread.
+struct ValueChangeBlock {
+	uint64_t m_start_time{0};
+	uint64_t m_end_time{0};
+	uint64_t m_num_timestamps{0};
+	uint64_t m_num_variables{0};
+	std::vector<uint8_t> m_bits_data{};
+	std::vector<std::vector<uint8_t>> m_wave_data{};
+	std::vector<uint8_t> m_time_data{};
+};
+
 }  // namespace detail
 
 class Writer {
@@ -89,6 +105,11 @@ private:
 	uint64_t m_value_change_data_flush_threshold_{128 << 20};  // 128MB
 	uint32_t m_enum_count_{0};
 	bool m_flush_pending_{false};
+	// Pipelined flushing: value change blocks are compressed by background threads,
+	// and written to file in order. At most m_max_pending_blocks_ blocks are in flight,
+	// 0 means compress and write on the calling thread.
+	uint32_t m_max_pending_blocks_{0};
+	std::deque<std::future<std::string>> m_pending_blocks_{};
 
 public:
 	Writer() {}
@@ -182,6 +203,12 @@ public:
 			handle
 		);
 	}
+	// Compress value change blocks in up to max_pending_blocks background threads,
+	// 0 (default) to compress synchronously when flushing
+	void setParallelFlush(uint32_t max_pending_blocks) {
+		drainPendingBlocks_(m_main_fst_file_);
+		m_max_pending_blocks_ = max_pending_blocks;
+	}
 	void setWriterPackType(WriterPackType pack_type) {
 		FST_CHECK(pack_type != WriterPackType::ZLIB && pack_type != WriterPackType::FASTLZ);
 		m_pack_type_ = pack_type;
@@ -240,20 +267,19 @@ private:
 	void appendGeometry_(std::ostream &os);
 	void appendHierarchy_(std::ostream &os);
 	void appendBlackout_(std::ostream &os);  // Not implemented yet
-	// This function is used to flush value change data to file, and keep only the latest value in
-	// memory Just want to separate the const part from the non-const part for code clarity
-	static void flushValueChangeDataConstPart_(
-		const detail::ValueChangeData &vcd, std::ostream &os, WriterPackType pack_type
+	// Value change data is flushed in two steps, so that the second (expensive) step can be
+	// done in background threads:
+	// 1. Capture the raw block from the in-memory data, then keep only the latest value
+	// 2. Compress and write the block
+	static detail::ValueChangeBlock captureValueChangeBlock_(const detail::ValueChangeData &vcd);
+	static void writeValueChangeBlock_(
+		detail::ValueChangeBlock &block, std::ostream &os, WriterPackType pack_type
 	);
-	void flushValueChangeData_(detail::ValueChangeData &vcd, std::ostream &os) {
-		if (vcd.m_timestamps.empty()) {
-			return;
-		}
-		flushValueChangeDataConstPart_(vcd, os, m_pack_type_);
-		vcd.keepOnlyTheLatestValue();
-		++m_header_.m_num_value_change_data_blocks;
-		m_value_change_data_usage_ = 0;
-		m_flush_pending_ = false;
+	void flushValueChangeData_(detail::ValueChangeData &vcd, std::ostream &os);
+	// Write the oldest/all pending background compressed blocks to file
+	void writeOldestPendingBlock_(std::ostream &os);
+	void drainPendingBlocks_(std::ostream &os) {
+		while (!m_pending_blocks_.empty()) writeOldestPendingBlock_(os);
 	}
 	void finalizeHierarchy_() {
 		if (m_hierarchy_finalized_) return;
@@ -60,6 +60,7 @@
 #include <cerrno>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <fcntl.h>
 #include <iostream>
@@ -67,6 +68,7 @@
 #include <list>
 #include <memory>
 #include <sstream>
+#include <thread>
 #include <utility>
 
 #include <sys/stat.h>  // mkdir
@@ -87,7 +89,9 @@
 # include <sys/time.h>
 # include <sys/resource.h>
 # include <unistd.h>
+# include <sys/mman.h>
 # define _VL_HAVE_GETRLIMIT
+# define _VL_HAVE_MMAP
 #endif
 #if VM_VPI
 # include <cstring>
@@ -132,6 +136,7 @@ thread_local Verilated::ThreadLocal Verilated::t_s;
 
 void vl_print_warn_error(const char* prefix, const char* filename, int linenum,
                          const char* msg) VL_MT_UNSAFE {
+    VerilatedLogSink::drain();  // Follow any $display output
     // A msg of "ERRORCODE: ..." is a code that changes to a prefix, e.g. "%Error-ERRORCODE: ..."
     // This avoids changing public API of the vl_stop and related functions.
     const char* msgNoCp = msg;
@@ -165,6 +170,7 @@ void vl_print_warn_error(const char* prefix, const char* filename, int linenum,
 #ifndef VL_USER_FINISH  ///< Define this to override the vl_finish function
 void vl_finish(const char* filename, int linenum, const char* hier) VL_MT_UNSAFE {
     (void)hier;  // hier is unused in the default implementation.
+    VerilatedLogSink::drain();
     VL_PRINTF(  // Not VL_PRINTF_MT, already on main thread
         "- %s:%d: Verilog $finish\n", filename, linenum);
     Verilated::threadContextp()->gotFinish(true);
@@ -383,9 +389,7 @@ void VL_PRINTF_MT(const char* formatp, ...) VL_MT_SAFE {
     va_start(ap, formatp);
     const std::string result = _vl_string_vprintf(formatp, ap);
     va_end(ap);
-    VerilatedThreadMsgQueue::post(VerilatedMsg{[=]() {  //
-        VL_PRINTF("%s", result.c_str());
-    }});
+    VerilatedThreadMsgQueue::postText(result);
 }
 
 void VL_FFLUSH_MT() VL_MT_SAFE {
@@ -410,6 +414,81 @@ static size_t _vl_snprintf_string(std::string& str, const char* format,
     return req_size;
 }
 
+//===========================================================================
+// VerilatedLogSink implementation
+
+void VerilatedLogSink::print(const std::string& text) VL_MT_SAFE {
+    VerilatedLogSink& s = singleton();
+    if (VL_LIKELY(!s.m_async)) {
+        VL_PRINTF("%s", text.c_str());
+        return;
+    }
+    s.m_mutex.lock();
+    if (VL_UNLIKELY(!s.m_async)) {
+        // Stopped meanwhile, let the writer finish first
+        while (s.m_writing || !s.m_pending.empty()) s.m_cv.wait(s.m_mutex);
+        s.m_mutex.unlock();
+        VL_PRINTF("%s", text.c_str());
+        return;
+    }
+    while (s.m_pending.size() >= MAX_PENDING) s.m_cv.wait(s.m_mutex);
+    s.m_pending.append(text.c_str());  // As VL_PRINTF would, up to any NUL
+    s.m_mutex.unlock();
+    s.m_cv.notify_all();
+}
+void VerilatedLogSink::async(bool flag) VL_MT_SAFE {
+    if (flag) {
+        singleton().start();
+    } else {
+        singleton().stop();
+    }
+}
+void VerilatedLogSink::drain() VL_MT_SAFE {
+    VerilatedLogSink& s = singleton();
+    if (VL_LIKELY(!s.m_async)) return;
+    s.m_mutex.lock();
+    while (s.m_writing || !s.m_pending.empty()) s.m_cv.wait(s.m_mutex);
+    s.m_mutex.unlock();
+}
+void VerilatedLogSink::start() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (m_async) return;
+    m_thread = std::thread{&VerilatedLogSink::writerMain, this};
+    m_async = true;
+}
+void VerilatedLogSink::stop() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        if (!m_async) return;
+        m_async = false;
+        m_shutdown = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+    const VerilatedLockGuard lock{m_mutex};
+    m_shutdown = false;
+    std::fflush(stdout);
+}
+void VerilatedLogSink::writerMain() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    std::string text;
+    m_mutex.lock();
+    while (true) {
+        while (m_pending.empty() && !m_shutdown) m_cv.wait(m_mutex);
+        if (m_pending.empty()) break;  // Shutdown, and all written
+        // Take everything pending, so printing continues while this is written
+        text.swap(m_pending);
+        m_writing = true;
+        m_mutex.unlock();
+        m_cv.notify_all();  // Unblock printing stalled on MAX_PENDING
+        (void)std::fwrite(text.data(), 1, text.size(), stdout);
+        text.clear();
+        m_mutex.lock();
+        m_writing = false;
+        m_cv.notify_all();
+    }
+    m_mutex.unlock();
+}
+
 //===========================================================================
 // Process -- parts of std::process implementation
 
@@ -2010,7 +2089,7 @@ void VL_WRITEF_NX(const std::string& format, int argc, ...) VL_MT_SAFE {
     _vl_vsformat(t_output, format, argc, ap);
     va_end(ap);
 
-    VL_PRINTF_MT("%s", t_output.c_str());
+    VerilatedThreadMsgQueue::postText(t_output);
 }
 
 void VL_FWRITEF_NX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE {
@@ -2103,7 +2182,7 @@ void VL_WRITEF_NX(const char* formatp, int argc, ...) VL_MT_SAFE {
     _vl_vsformat(t_output, formatp, argc, ap);
     va_end(ap);
 
-    VL_PRINTF_MT("%s", t_output.c_str());
+    VerilatedThreadMsgQueue::postText(t_output);
 }
 
 void VL_FWRITEF_NX(IData fpi, const char* formatp, int argc, ...) VL_MT_SAFE {
@@ -2117,6 +2196,142 @@ void VL_FWRITEF_NX(IData fpi, const char* formatp, int argc, ...) VL_MT_SAFE {
     Verilated::threadContextp()->impp()->fdWrite(fpi, t_output);
 }
 
+//===========================================================================
+// Formatting with a format string parsed at Verilation time
+// Must produce the same output as the equivalent conversions in _vl_vsformat
+
+void VlFormat::pad(const std::string& digits, int width, int flags, char padChar) VL_MT_SAFE {
+    const int needmore = width - static_cast<int>(digits.size());
+    if (needmore <= 0) {
+        m_out += digits;
+    } else if (flags & F_LEFT) {
+        m_out += digits;
+        m_out.append(needmore, ' ');
+    } else {
+        m_out.append(needmore, padChar);
+        m_out += digits;
+    }
+}
+
+VlFormat& VlFormat::scope(const char* modulep, const char* scopep) VL_MT_SAFE {
+    if (modulep) m_out += modulep;
+    if (modulep && modulep[0] && scopep && scopep[0]) m_out += '.';
+    if (scopep) m_out += scopep;
+    return *this;
+}
+
+VlFormat& VlFormat::dec(int lbits, QData ld, int width, int flags) VL_MT_SAFE {
+    static thread_local std::string t_digits;
+    const bool isSigned = flags & F_SIGNED;
+    const int64_t sld = static_cast<int64_t>(VL_EXTENDS_QQ(lbits, lbits, ld));
+    const bool negative = isSigned && sld < 0;
+    QData mag = negative ? (0 - static_cast<QData>(sld)) : ld;
+    char buf[24];
+    char* const endp = buf + sizeof(buf);
+    char* digitp = endp;
+    do {
+        *--digitp = static_cast<char>('0' + mag % 10);
+        mag /= 10;
+    } while (mag);
+    if (negative) *--digitp = '-';
+    t_digits.assign(digitp, endp);
+    if (width < 0) {
+        const double mantissabits = lbits - (isSigned ? 1 : 0);
+        // This is log10(2**mantissabits) as log2(2**mantissabits)/log2(10),
+        // + 1.0 rounding bias.
+        double dchars = mantissabits / 3.321928094887362 + 1.0;
+        if (isSigned) ++dchars;  // space for sign
+        width = static_cast<int>(dchars);
+    }
+    pad(t_digits, width, flags, (flags & F_ZERO) ? '0' : ' ');
+    return *this;
+}
+
+// Most significant digit position for %b/%o/%h, as _vl_vsformat computes it
+static int _vl_format_radix_lsb(int lbits, QData ld, int width, int flags) VL_PURE {
+    if (width < 0 && !(flags & VlFormat::F_LEFT)) return lbits - 1;
+    const int lsb = static_cast<int>(VL_MOSTSETBITP1_Q(ld)) - 1;
+    return (lsb < 1) ? 0 : lsb;
+}
+
+VlFormat& VlFormat::bin(int lbits, QData ld, int width, int flags) VL_MT_SAFE {
+    static thread_local std::string t_digits;
+    t_digits.clear();
+    for (int lsb = _vl_format_radix_lsb(lbits, ld, width, flags); lsb >= 0; --lsb) {
+        t_digits += static_cast<char>('0' + ((ld >> lsb) & 1));
+    }
+    pad(t_digits, width < 0 ? 0 : width, flags, '0');
+    return *this;
+}
+
+VlFormat& VlFormat::oct(int lbits, QData ld, int width, int flags) VL_MT_SAFE {
+    static thread_local std::string t_digits;
+    t_digits.clear();
+    for (int lsb = _vl_format_radix_lsb(lbits, ld, width, flags); lsb >= 0; --lsb) {
+        lsb = (lsb / 3) * 3;  // Next digit
+        t_digits += static_cast<char>('0' + ((ld >> lsb) & 7));
+    }
+    pad(t_digits, width < 0 ? 0 : width, flags, '0');
+    return *this;
+}
+
+VlFormat& VlFormat::hex(int lbits, QData ld, int width, int flags) VL_MT_SAFE {
+    static thread_local std::string t_digits;
+    t_digits.clear();
+    for (int lsb = _vl_format_radix_lsb(lbits, ld, width, flags); lsb >= 0; --lsb) {
+        lsb = (lsb / 4) * 4;  // Next digit
+        t_digits += "0123456789abcdef"[(ld >> lsb) & 0xf];
+    }
+    pad(t_digits, width < 0 ? 0 : width, flags, '0');
+    return *this;
+}
+
+VlFormat& VlFormat::chars(int lbits, QData ld, int width, int flags) VL_MT_SAFE {
+    static thread_local std::string t_digits;
+    t_digits.clear();
+    int lsb = lbits - 1;
+    if (width == 0) {
+        while (lsb && !((ld >> lsb) & 1)) --lsb;
+    }
+    for (; lsb >= 0; --lsb) {
+        lsb = (lsb / 8) * 8;  // Next digit
+        const char charval = static_cast<char>((ld >> lsb) & 0xff);
+        t_digits += (charval == 0) ? ' ' : charval;
+    }
+    pad(t_digits, width < 0 ? 0 : width, flags, ' ');
+    return *this;
+}
+
+VlFormat& VlFormat::str(const std::string& value, int width, int flags) VL_MT_SAFE {
+    pad(value, width < 0 ? 0 : width, flags, ' ');
+    return *this;
+}
+
+void VL_SFORMAT_S(int obits, CData& destr, const std::string& output) VL_MT_SAFE {
+    _vl_string_to_vint(obits, &destr, output.length(), output.c_str());
+}
+void VL_SFORMAT_S(int obits, SData& destr, const std::string& output) VL_MT_SAFE {
+    _vl_string_to_vint(obits, &destr, output.length(), output.c_str());
+}
+void VL_SFORMAT_S(int obits, IData& destr, const std::string& output) VL_MT_SAFE {
+    _vl_string_to_vint(obits, &destr, output.length(), output.c_str());
+}
+void VL_SFORMAT_S(int obits, QData& destr, const std::string& output) VL_MT_SAFE {
+    _vl_string_to_vint(obits, &destr, output.length(), output.c_str());
+}
+void VL_SFORMAT_S(int obits, EData* destp, const std::string& output) VL_MT_SAFE {
+    _vl_string_to_vint(obits, destp, output.length(), output.c_str());
+}
+
+void VL_WRITEF_S(const std::string& output) VL_MT_SAFE {
+    VerilatedThreadMsgQueue::postText(output);
+}
+
+void VL_FWRITEF_S(IData fpi, const std::string& output) VL_MT_SAFE {
+    // While threadsafe, each thread can only access different file handles
+    Verilated::threadContextp()->impp()->fdWrite(fpi, output);
+}
+
 IData VL_FSCANF_INX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE {
     // While threadsafe, each thread can only access different file handles
     FILE* const fp = VL_CVT_I_FP(fpi);
@@ -2348,6 +2563,8 @@ IData VL_SYSTEM_IN(const std::string& lhs) VL_MT_SAFE {
     const bool sending = ctxp->logOutputToFile();
     // system() command may echo and read so restore default stdout and stderr if sending
     if (sending) ctxp->logRestoreOutput();
+    VerilatedLogSink::drain();
+    std::fflush(stdout);
     const int code = std::system(lhs.c_str());  // Yes, std::system() is threadsafe
     // Log to file again if we were sending
     if (sending) ctxp->logOutputToFile(true /* append */);
@@ -2619,107 +2836,506 @@ static const char* formatBinary(int nBits, uint32_t bits) {
     return t_buf;
 }
 
+#ifndef VL_READMEM_CHUNK_BYTES  ///< Define this to override the $readmem parallel chunk size
+#define VL_READMEM_CHUNK_BYTES (16 * 1024 * 1024)
+#endif
+
+// Leading bytes of a binary $readmem image, see the $readmemh documentation
+static constexpr char VL_READMEM_IMAGE_MAGIC[8] = {'V', 'L', 'M', 'E', 'M', 'I', 'M', '1'};
+
+// Classification of $readmem characters: hex digit value, or one of the below
+class VlReadMemChars final {
+    uint8_t m_class[256];
+
+public:
+    enum : uint8_t { XZ = 16, UNDERSCORE = 17, OTHER = 18 };
+    VlReadMemChars() {
+        for (int c = 0; c < 256; ++c) m_class[c] = OTHER;
+        for (int c = '0'; c <= '9'; ++c) m_class[c] = c - '0';
+        for (int c = 'a'; c <= 'f'; ++c) m_class[c] = m_class[c - 'a' + 'A'] = c - 'a' + 10;
+        m_class['x'] = m_class['X'] = m_class['z'] = m_class['Z'] = XZ;
+        m_class['_'] = UNDERSCORE;
+    }
+    uint8_t operator[](char c) const { return m_class[static_cast<unsigned char>(c)]; }
+};
+static const VlReadMemChars s_readMemChars;
+
+// Character state machine over $readmem text, shared by VlReadMem::get
+// and the bulk loader.  Each next() starts afresh, as did the original
+// reader of one value per call.
+class VlReadMemScan final {
+public:
+    const char* m_p;  // Next character to read
+    const char* const m_endp;  // End of text
+    const bool m_hex;  // Hex format
+    QData m_addr;  // Address of next value
+    int m_linenum;  // Line number of m_p
+    bool m_anyAddr = false;  // Had address directive
+    bool m_blockComment = false;  // Had /* comment
+    bool m_valueXZ = false;  // Last value has x/z digits
+    const char* m_errorp = nullptr;  // Error message, once scanning failed
+
+    VlReadMemScan(const char* beginp, const char* endp, bool hex, QData addr, int linenum)
+        : m_p{beginp}
+        , m_endp{endp}
+        , m_hex{hex}
+        , m_addr{addr}
+        , m_linenum{linenum} {}
+
+    // Find the next value, which may contain '_' separators.
+    // Returns false at end of text, or on error with m_errorp set.
+    bool next(QData& addrr, const char*& valbpr, const char*& valepr) {
+        if (VL_UNLIKELY(m_errorp)) return false;
+        bool ignoreToEol = false;
+        bool ignoreToComment = false;
+        bool readingAddress = false;
+        int lastCh = ' ';
+        while (m_p < m_endp) {
+            const char c = *m_p++;
+            const uint8_t cclass = s_readMemChars[c];
+            if (cclass == VlReadMemChars::UNDERSCORE) continue;  // Ignore _ e.g. inside a number
+            if (c == '\n') {
+                ++m_linenum;
+                ignoreToEol = false;
+                readingAddress = false;
+            } else if (c == '\t' || c == ' ' || c == '\r' || c == '\f') {
+                readingAddress = false;
+            }
+            // Skip // comments and detect /* comments
+            else if (ignoreToComment && lastCh == '*' && c == '/') {
+                ignoreToComment = false;
+                readingAddress = false;
+            } else if (!ignoreToEol && !ignoreToComment) {
+                if (lastCh == '/' && c == '*') {
+                    ignoreToComment = true;
+                    m_blockComment = true;
+                } else if (lastCh == '/' && c == '/') {
+                    ignoreToEol = true;
+                } else if (c == '/') {  // Part of /* or //
+                } else if (c == '#') {
+                    ignoreToEol = true;
+                } else if (c == '@') {
+                    readingAddress = true;
+                    m_anyAddr = true;
+                    m_addr = 0;
+                } else if (readingAddress && cclass < VlReadMemChars::XZ) {
+                    m_addr = (m_addr << 4) + cclass;
+                } else if (readingAddress && cclass == VlReadMemChars::XZ) {
+                    m_errorp = "$readmem address contains 4-state characters";
+                    return false;
+                } else if (cclass <= VlReadMemChars::XZ) {
+                    // Value runs to the first character that is not part of a number
+                    const char* valep = m_p - 1;
+                    m_valueXZ = false;
+                    for (; valep < m_endp; ++valep) {
+                        const uint8_t vclass = s_readMemChars[*valep];
+                        if (vclass < VlReadMemChars::XZ) {
+                            if (VL_UNLIKELY(!m_hex && vclass > 1)) {
+                                m_errorp = "$readmemb (binary) file contains hex characters";
+                                return false;
+                            }
+                        } else if (vclass == VlReadMemChars::XZ) {
+                            m_valueXZ = true;
+                        } else if (vclass != VlReadMemChars::UNDERSCORE) {
+                            break;
+                        }
+                    }
+                    valbpr = m_p - 1;
+                    valepr = valep;
+                    m_p = valep;
+                    addrr = m_addr++;
+                    return true;
+                } else {
+                    m_errorp = "$readmem file syntax error";
+                    return false;
+                }
+            }
+            lastCh = c;
+        }
+        return false;
+    }
+};
+
+// Decode a value with no x/z digits into a row of the given width
+static void vlReadMemDecode(bool hex, int bits, const char* valbp, const char* valep,
+                            void* rowp) VL_MT_SAFE {
+    const int shift = hex ? 4 : 1;
+    if (bits <= VL_QUADSIZE) {
+        QData value = 0;
+        for (const char* p = valbp; p < valep; ++p) {
+            if (*p != '_') value = (value << shift) | s_readMemChars[*p];
+        }
+        value &= VL_MASK_Q(bits);
+        if (bits <= 8) {
+            *static_cast<CData*>(rowp) = static_cast<CData>(value);
+        } else if (bits <= 16) {
+            *static_cast<SData*>(rowp) = static_cast<SData>(value);
+        } else if (bits <= VL_IDATASIZE) {
+            *static_cast<IData*>(rowp) = static_cast<IData>(value);
+        } else {
+            *static_cast<QData*>(rowp) = value;
+        }
+    } else {
+        // Fill from the last digit, which is the least significant
+        EData* const datap = static_cast<EData*>(rowp);
+        const int words = VL_WORDS_I(bits);
+        for (int i = 0; i < words; ++i) datap[i] = 0;
+        int lsb = 0;
+        for (const char* p = valep; p > valbp && lsb < bits;) {
+            const char c = *--p;
+            if (c == '_') continue;
+            datap[VL_BITWORD_E(lsb)] |= static_cast<EData>(s_readMemChars[c]) << VL_BITBIT_E(lsb);
+            lsb += shift;
+        }
+        datap[words - 1] &= VL_MASK_E(bits);
+    }
+}
+
+// Bytes of storage for one row of the given width
+static size_t vlReadMemRowBytes(int bits) VL_PURE {
+    return bits <= 8               ? sizeof(CData)
+           : bits <= 16            ? sizeof(SData)
+           : bits <= VL_IDATASIZE  ? sizeof(IData)
+           : bits <= VL_QUADSIZE   ? sizeof(QData)
+                                   : VL_WORDS_I(bits) * sizeof(EData);
+}
+
+// Mask every stride'th element of rows elements
+template <typename T_Data>
+static void vlReadMemMaskRows(T_Data* datap, QData rows, int stride, T_Data mask) VL_MT_SAFE {
+    if (mask == static_cast<T_Data>(~T_Data{0})) return;
+    for (QData row = 0; row < rows; ++row) datap[row * stride] &= mask;
+}
+
+// Threads $readmem may use; +verilator+readmem+threads, else the processors
+// available to the process, independent of the model's simulation threads
+static unsigned vlReadMemThreads() VL_MT_SAFE {
+    const unsigned threads = Verilated::threadContextp()->readmemThreads();
+    return threads ? threads : std::max(1U, VlOs::getProcessDefaultParallelism());
+}
+
+// Call func(index) for each index in [0, count), spread across threads
+template <typename T_Func>
+static void vlReadMemParallel(size_t count, T_Func func) {
+    const size_t nthreads = std::min<size_t>(count, vlReadMemThreads());
+    std::atomic<size_t> nextIndex{0};
+    const auto work = [&]() {
+        for (size_t i; (i = nextIndex++) < count;) func(i);
+    };
+    std::vector<std::thread> threads;
+    for (size_t n = 1; n < nthreads; ++n) threads.emplace_back(work);
+    work();
+    for (std::thread& thread : threads) thread.join();
+}
+
 VlReadMem::VlReadMem(bool hex, int bits, const std::string& filename, QData start, QData end)
     : m_hex{hex}
     , m_bits{bits}
     , m_filename(filename)  // Need () or GCC 4.8 false warning
     , m_end{end}
     , m_addr{start} {
-    m_fp = std::fopen(filename.c_str(), "r");
-    if (VL_UNLIKELY(!m_fp)) {
+#ifdef _VL_HAVE_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat sb;
+        if (::fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode)) {
+            m_size = static_cast<size_t>(sb.st_size);
+            void* const mapp
+                = m_size ? ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+            if (mapp != MAP_FAILED) {
+                ::madvise(mapp, m_size, MADV_SEQUENTIAL);
+                m_datap = static_cast<const char*>(mapp);
+                m_mapped = true;
+            }
+            m_isOpen = m_mapped || !m_size;
+        }
+        ::close(fd);
+        if (m_isOpen) return;
+    }
+#endif
+    // Otherwise read it all, e.g. a pipe
+    FILE* const fp = std::fopen(filename.c_str(), "rb");
+    if (VL_UNLIKELY(!fp)) {
         // We don't report the Verilog source filename as it slow to have to pass it down
         VL_WARN_MT(filename.c_str(), 0, "", "$readmem file not found");
         return;
     }
+    char buf[65536];
+    while (const size_t got = std::fread(buf, 1, sizeof(buf), fp)) m_text.append(buf, got);
+    std::fclose(fp);
+    m_datap = m_text.data();
+    m_size = m_text.size();
+    m_isOpen = true;
 }
 VlReadMem::~VlReadMem() {
-    if (m_fp) {
-        std::fclose(m_fp);
-        m_fp = nullptr;
+#ifdef _VL_HAVE_MMAP
+    if (m_mapped) ::munmap(const_cast<char*>(m_datap), m_size);
+#endif
+}
+void VlReadMem::endCheck() {
+    if (VL_UNLIKELY(m_end != ~0ULL && m_addr <= m_end && !m_anyAddr)) {
+        VL_WARN_MT(m_filename.c_str(), m_linenum, "",
+                   "$readmem file ended before specified final address (IEEE 1800-2023 21.4)");
     }
 }
 bool VlReadMem::get(QData& addrr, std::string& valuer) {
-    if (VL_UNLIKELY(!m_fp)) return false;
     valuer = "";
-    // Prep for reading
-    bool inData = false;
-    bool ignoreToEol = false;
-    bool ignoreToComment = false;
-    bool readingAddress = false;
-    int lastCh = ' ';
-    // Read the data
-    // We process a character at a time, as then we don't need to deal
-    // with changing buffer sizes dynamically, etc.
-    while (true) {
-        int c = std::fgetc(m_fp);
-        if (VL_UNLIKELY(c == EOF)) break;
-        const bool chIs4StateBin
-            = c == '0' || c == '1' || c == 'x' || c == 'X' || c == 'z' || c == 'Z';
-        const bool chIs2StateHex = std::isxdigit(c);
-        const bool chIs4StateHex = std::isxdigit(c) || chIs4StateBin;
-        // printf("%d: Got '%c' Addr%lx IN%d IgE%d IgC%d\n",
-        //        m_linenum, c, m_addr, inData, ignoreToEol, ignoreToComment);
-        // See if previous data value has completed, and if so return
-        if (c == '_') continue;  // Ignore _ e.g. inside a number
-        if (inData && !chIs4StateHex) {
-            // printf("Got data @%lx = %s\n", m_addr, valuer.c_str());
-            ungetc(c, m_fp);
-            addrr = m_addr;
-            ++m_addr;
-            return true;
+    if (VL_UNLIKELY(!m_isOpen)) return false;
+    VlReadMemScan scan{m_datap + m_pos, m_datap + m_size, m_hex, m_addr, m_linenum};
+    const char* valbp = nullptr;
+    const char* valep = nullptr;
+    const bool got = scan.next(addrr /*ref*/, valbp /*ref*/, valep /*ref*/);
+    m_pos = scan.m_p - m_datap;
+    m_addr = scan.m_addr;
+    m_linenum = scan.m_linenum;
+    m_anyAddr |= scan.m_anyAddr;
+    if (VL_UNLIKELY(scan.m_errorp)) {
+        VL_FATAL_MT(m_filename.c_str(), m_linenum, "", scan.m_errorp);
+        return false;
+    }
+    if (!got) {
+        endCheck();
+        addrr = m_addr;
+        return false;
+    }
+    for (const char* p = valbp; p < valep; ++p) {
+        if (*p != '_') valuer += *p;
+    }
+    return true;
+}
+void VlReadMem::load(QData depth, int array_lsb, void* memp) {
+    if (VL_UNLIKELY(!m_isOpen)) return;
+    if (m_size - m_pos >= sizeof(VL_READMEM_IMAGE_MAGIC)
+        && std::memcmp(m_datap + m_pos, VL_READMEM_IMAGE_MAGIC, sizeof(VL_READMEM_IMAGE_MAGIC))
+               == 0) {
+        loadImage(depth, array_lsb, memp);
+    } else {
+        loadText(depth, array_lsb, memp);
+    }
+}
+void VlReadMem::loadImage(QData depth, int array_lsb, void* memp) {
+    // Header, then segments of address, row count and rows, all little endian
+    const auto readLe = [](const unsigned char* p, size_t bytes) {
+        QData value = 0;
+        for (size_t i = bytes; i-- > 0;) value = (value << 8) | p[i];
+        return value;
+    };
+    const unsigned char* p
+        = reinterpret_cast<const unsigned char*>(m_datap + m_pos) + sizeof(VL_READMEM_IMAGE_MAGIC);
+    const unsigned char* const endp = reinterpret_cast<const unsigned char*>(m_datap + m_size);
+    const size_t rowBytes = vlReadMemRowBytes(m_bits);
+    if (VL_UNLIKELY(endp - p < 4)) {
+        VL_FATAL_MT(m_filename.c_str(), 0, "", "$readmem binary image is truncated");
+        return;
+    }
+    if (VL_UNLIKELY(readLe(p, 4) != static_cast<QData>(m_bits))) {
+        VL_FATAL_MT(m_filename.c_str(), 0, "",
+                    "$readmem binary image row width does not match array");
+        return;
+    }
+    p += 4;
+    m_anyAddr = true;
+    while (p < endp) {
+        if (VL_UNLIKELY(endp - p < 16)) {
+            VL_FATAL_MT(m_filename.c_str(), 0, "", "$readmem binary image is truncated");
+            return;
+        }
+        const QData addr = readLe(p, 8);
+        const QData rows = readLe(p + 8, 8);
+        p += 16;
+        if (VL_UNLIKELY(rows > static_cast<size_t>(endp - p) / rowBytes)) {
+            VL_FATAL_MT(m_filename.c_str(), 0, "", "$readmem binary image is truncated");
+            return;
+        }
+        if (VL_UNLIKELY(addr < static_cast<QData>(array_lsb)
+                        || addr - array_lsb > depth || rows > depth - (addr - array_lsb))) {
+            VL_FATAL_MT(m_filename.c_str(), 0, "",
+                        "$readmem file address beyond bounds of array");
+            return;
         }
-        // Parse line
-        if (c == '\n') {
-            ++m_linenum;
-            ignoreToEol = false;
-            readingAddress = false;
-        } else if (c == '\t' || c == ' ' || c == '\r' || c == '\f') {
-            readingAddress = false;
+        uint8_t* const rowsp = static_cast<uint8_t*>(memp) + (addr - array_lsb) * rowBytes;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        // Rows up to a QData are one word; wider rows are arrays of EData
+        const size_t wordBytes = rowBytes <= sizeof(QData) ? rowBytes : sizeof(EData);
+        for (size_t i = 0; i < rows * rowBytes; i += wordBytes) {
+            const QData word = readLe(p + i, wordBytes);
+            std::memcpy(rowsp + i, reinterpret_cast<const uint8_t*>(&word) + 8 - wordBytes,
+                        wordBytes);
         }
-        // Skip // comments and detect /* comments
-        else if (ignoreToComment && lastCh == '*' && c == '/') {
-            ignoreToComment = false;
-            readingAddress = false;
-        } else if (!ignoreToEol && !ignoreToComment) {
-            if (lastCh == '/' && c == '*') {
-                ignoreToComment = true;
-            } else if (lastCh == '/' && c == '/') {
-                ignoreToEol = true;
-            } else if (c == '/') {  // Part of /* or //
-            } else if (c == '#') {
-                ignoreToEol = true;
-            } else if (c == '@') {
-                readingAddress = true;
-                m_anyAddr = true;
-                m_addr = 0;
-            } else if (readingAddress && chIs2StateHex) {
-                c = std::tolower(c);
-                const int addressValue = (c >= 'a') ? (c - 'a' + 10) : (c - '0');
-                m_addr = (m_addr << 4) + addressValue;
-            } else if (readingAddress && chIs4StateHex) {
-                VL_FATAL_MT(m_filename.c_str(), m_linenum, "",
-                            "$readmem address contains 4-state characters");
-            } else if (chIs4StateHex) {
-                inData = true;
-                valuer += static_cast<char>(c);
-                if (VL_UNLIKELY(!m_hex && !chIs4StateBin)) {
-                    VL_FATAL_MT(m_filename.c_str(), m_linenum, "",
-                                "$readmemb (binary) file contains hex characters");
+#else
+        std::memcpy(rowsp, p, rows * rowBytes);
+#endif
+        // Clean bits above the row width, as a text image would
+        if (m_bits <= 8) {
+            vlReadMemMaskRows<CData>(reinterpret_cast<CData*>(rowsp), rows, 1,
+                                     VL_MASK_I(m_bits));
+        } else if (m_bits <= 16) {
+            vlReadMemMaskRows<SData>(reinterpret_cast<SData*>(rowsp), rows, 1,
+                                     VL_MASK_I(m_bits));
+        } else if (m_bits <= VL_IDATASIZE) {
+            vlReadMemMaskRows<IData>(reinterpret_cast<IData*>(rowsp), rows, 1,
+                                     VL_MASK_I(m_bits));
+        } else if (m_bits <= VL_QUADSIZE) {
+            vlReadMemMaskRows<QData>(reinterpret_cast<QData*>(rowsp), rows, 1,
+                                     VL_MASK_Q(m_bits));
+        } else {
+            vlReadMemMaskRows<EData>(reinterpret_cast<EData*>(rowsp) + VL_WORDS_I(m_bits) - 1,
+                                     rows, VL_WORDS_I(m_bits), VL_MASK_E(m_bits));
+        }
+        p += rows * rowBytes;
+        m_addr = addr + rows;
+    }
+    m_pos = m_size;
+}
+void VlReadMem::loadText(QData depth, int array_lsb, void* memp) {
+    const auto rowp = [this, array_lsb, memp](QData addr) -> void* {
+        return static_cast<uint8_t*>(memp) + (addr - array_lsb) * vlReadMemRowBytes(m_bits);
+    };
+    const auto inBounds = [array_lsb, depth](QData addr) {
+        return addr >= static_cast<QData>(array_lsb)
+               && addr < static_cast<QData>(array_lsb + depth);
+    };
+    // Large images are split at line boundaries into chunks.  A first
+    // parallel pass finds the lines and addresses each chunk covers, then a
+    // second decodes the chunks in parallel.  Images where that would not
+    // match reading in order (block comments that may span chunks, x/z
+    // values needing random bits, overlapping addresses or errors) are
+    // instead read serially.
+    struct Chunk final {
+        const char* m_bp;  // First character
+        const char* m_ep;  // End of chunk
+        QData m_lead = 0;  // Values before any address directive
+        QData m_minAddr = ~0ULL;  // Lowest address after an address directive
+        QData m_maxAddr = 0;  // Highest address after an address directive
+        QData m_endAddr = 0;  // Address after the last value, when m_anyAddr
+        QData m_startAddr = 0;  // Address of the first value
+        int m_lines = 0;  // Lines in chunk
+        int m_lineBase = 0;  // Line number at chunk start
+        bool m_anyAddr = false;  // Had address directive
+        bool m_serial = false;  // Must read serially
+        const char* m_errorp = nullptr;  // Bounds error message
+        int m_errorLine = 0;  // Line number of error
+    };
+    std::vector<Chunk> chunks;
+    const bool threaded = vlReadMemThreads() > 1;
+    for (const char* bp = m_datap + m_pos; bp < m_datap + m_size;) {
+        const char* ep = m_datap + m_size;
+        if (threaded && static_cast<size_t>(ep - bp) > VL_READMEM_CHUNK_BYTES) {
+            const char* const nlp = static_cast<const char*>(std::memchr(
+                bp + VL_READMEM_CHUNK_BYTES, '\n', ep - bp - VL_READMEM_CHUNK_BYTES));
+            if (nlp) ep = nlp + 1;
+        }
+        chunks.emplace_back();
+        chunks.back().m_bp = bp;
+        chunks.back().m_ep = ep;
+        bp = ep;
+    }
+    bool serial = chunks.size() <= 1;
+    if (!serial) {
+        vlReadMemParallel(chunks.size(), [&](size_t i) {
+            Chunk& chunk = chunks[i];
+            VlReadMemScan scan{chunk.m_bp, chunk.m_ep, m_hex, 0, 0};
+            QData addr;
+            const char* valbp;
+            const char* valep;
+            while (!chunk.m_serial && scan.next(addr /*ref*/, valbp /*ref*/, valep /*ref*/)) {
+                if (!scan.m_anyAddr) {
+                    ++chunk.m_lead;
+                } else {
+                    chunk.m_minAddr = std::min(chunk.m_minAddr, addr);
+                    chunk.m_maxAddr = std::max(chunk.m_maxAddr, addr);
                 }
-            } else {
-                VL_FATAL_MT(m_filename.c_str(), m_linenum, "", "$readmem file syntax error");
+                chunk.m_serial = scan.m_valueXZ;
             }
+            chunk.m_serial |= scan.m_blockComment || scan.m_errorp;
+            chunk.m_lines = scan.m_linenum;
+            chunk.m_anyAddr = scan.m_anyAddr;
+            chunk.m_endAddr = scan.m_addr;
+        });
+        // Place chunks, and check no two chunks write the same rows
+        std::vector<std::pair<QData, QData>> spans;
+        for (Chunk& chunk : chunks) {
+            serial |= chunk.m_serial;
+            chunk.m_startAddr = m_addr;
+            chunk.m_lineBase = m_linenum;
+            QData lo = chunk.m_minAddr;
+            QData hi = chunk.m_maxAddr;
+            if (chunk.m_lead) {
+                lo = std::min(lo, m_addr);
+                hi = std::max(hi, m_addr + chunk.m_lead - 1);
+            }
+            if (lo <= hi) spans.emplace_back(lo, hi);
+            m_addr = chunk.m_anyAddr ? chunk.m_endAddr : m_addr + chunk.m_lead;
+            m_linenum += chunk.m_lines;
+            m_anyAddr |= chunk.m_anyAddr;
+        }
+        std::sort(spans.begin(), spans.end());
+        for (size_t i = 1; i < spans.size(); ++i) serial |= spans[i].first <= spans[i - 1].second;
+        if (serial) {
+            m_addr = chunks.front().m_startAddr;
+            m_linenum = chunks.front().m_lineBase;
+            m_anyAddr = false;
         }
-        lastCh = c;
     }
-
-    if (VL_UNLIKELY(m_end != ~0ULL && m_addr <= m_end && !m_anyAddr)) {
-        VL_WARN_MT(m_filename.c_str(), m_linenum, "",
-                   "$readmem file ended before specified final address (IEEE 1800-2023 21.4)");
+    if (!serial) {
+        vlReadMemParallel(chunks.size(), [&](size_t i) {
+            Chunk& chunk = chunks[i];
+            VlReadMemScan scan{chunk.m_bp, chunk.m_ep, m_hex, chunk.m_startAddr,
+                               chunk.m_lineBase};
+            QData addr;
+            const char* valbp;
+            const char* valep;
+            while (scan.next(addr /*ref*/, valbp /*ref*/, valep /*ref*/)) {
+                if (VL_UNLIKELY(!inBounds(addr))) {
+                    chunk.m_errorp = "$readmem file address beyond bounds of array";
+                    chunk.m_errorLine = scan.m_linenum;
+                    break;
+                }
+                vlReadMemDecode(m_hex, m_bits, valbp, valep, rowp(addr));
+            }
+        });
+        for (const Chunk& chunk : chunks) {
+            if (VL_UNLIKELY(chunk.m_errorp)) {
+                m_linenum = chunk.m_errorLine;
+                VL_FATAL_MT(m_filename.c_str(), m_linenum, "", chunk.m_errorp);
+                return;
+            }
+        }
+        m_pos = m_size;
+        endCheck();
+        return;
     }
-
-    addrr = m_addr;
-    return inData;  // EOF
+    VlReadMemScan scan{m_datap + m_pos, m_datap + m_size, m_hex, m_addr, m_linenum};
+    QData addr;
+    const char* valbp;
+    const char* valep;
+    while (scan.next(addr /*ref*/, valbp /*ref*/, valep /*ref*/)) {
+        if (VL_UNLIKELY(!inBounds(addr))) {
+            m_linenum = scan.m_linenum;
+            VL_FATAL_MT(m_filename.c_str(), m_linenum, "",
+                        "$readmem file address beyond bounds of array");
+            return;
+        }
+        if (VL_UNLIKELY(scan.m_valueXZ)) {
+            // Random x/z bits are drawn in order
+            std::string value;
+            for (const char* p = valbp; p < valep; ++p) {
+                if (*p != '_') value += *p;
+            }
+            setData(rowp(addr), value);
+        } else {
+            vlReadMemDecode(m_hex, m_bits, valbp, valep, rowp(addr));
+        }
+    }
+    m_pos = scan.m_p - m_datap;
+    m_addr = scan.m_addr;
+    m_linenum = scan.m_linenum;
+    m_anyAddr |= scan.m_anyAddr;
+    if (VL_UNLIKELY(scan.m_errorp)) {
+        VL_FATAL_MT(m_filename.c_str(), m_linenum, "", scan.m_errorp);
+        return;
+    }
+    endCheck();
 }
 void VlReadMem::setData(void* valuep, const std::string& rhs) {
     const QData shift = m_hex ? 4ULL : 1ULL;
@@ -2863,40 +3479,7 @@ void VL_READMEM_N(bool hex,  // Hex format, else binary
     if (start < static_cast<QData>(array_lsb)) start = array_lsb;
 
     VlReadMem rmem{hex, bits, filename, start, end};
-    if (VL_UNLIKELY(!rmem.isOpen())) return;
-    while (true) {
-        QData addr = 0;
-        std::string value;
-        if (rmem.get(addr /*ref*/, value /*ref*/)) {
-            // printf("readmem.get [%" PRIu64 "]=%s\n", addr, value.c_str());
-            if (VL_UNLIKELY(addr < static_cast<QData>(array_lsb)
-                            || addr >= static_cast<QData>(array_lsb + depth))) {
-                VL_FATAL_MT(filename.c_str(), rmem.linenum(), "",
-                            "$readmem file address beyond bounds of array");
-            } else {
-                const QData entry = addr - array_lsb;
-                if (bits <= 8) {
-                    CData* const datap = &(reinterpret_cast<CData*>(memp))[entry];
-                    rmem.setData(datap, value);
-                } else if (bits <= 16) {
-                    SData* const datap = &(reinterpret_cast<SData*>(memp))[entry];
-                    rmem.setData(datap, value);
-                } else if (bits <= VL_IDATASIZE) {
-                    IData* const datap = &(reinterpret_cast<IData*>(memp))[entry];
-                    rmem.setData(datap, value);
-                } else if (bits <= VL_QUADSIZE) {
-                    QData* const datap = &(reinterpret_cast<QData*>(memp))[entry];
-                    rmem.setData(datap, value);
-                } else {
-                    EData* const datap
-                        = &(reinterpret_cast<EData*>(memp))[entry * VL_WORDS_I(bits)];
-                    rmem.setData(datap, value);
-                }
-            }
-        } else {
-            break;
-        }
-    }
+    rmem.load(depth, array_lsb, memp);
 }
 
 void VL_WRITEMEM_N(bool hex,  // Hex format, else binary
@@ -3208,6 +3791,25 @@ std::string VerilatedContext::coverageFilename() const VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_coverageFilename;
 }
+void VerilatedContext::coverageBinary(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_coverageBinary = flag;
+}
+bool VerilatedContext::coverageBinary() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_coverageBinary;
+}
+void VerilatedContext::logAsync(bool flag) VL_MT_SAFE {
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        m_ns.m_logAsync = flag;
+    }
+    VerilatedLogSink::async(flag);
+}
+bool VerilatedContext::logAsync() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_logAsync;
+}
 void VerilatedContext::logFilename(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     assert(m_ns.m_logFD == -1);
@@ -3242,6 +3844,7 @@ void VerilatedContext::logOutputToFile(bool append) VL_MT_SAFE {
     if (!error_msg.empty()) { VL_FATAL_MT("", 0, "", error_msg.c_str()); }
 }
 void VerilatedContext::logRestoreOutput() VL_MT_SAFE {
+    VerilatedLogSink::drain();
     const VerilatedLockGuard lock{m_mutex};
     if (m_ns.m_logFD >= 0) {
         std::fflush(stdout);  // Flush logfile
@@ -3323,6 +3926,10 @@ void VerilatedContext::profExecWindow(uint64_t flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_profExecWindow = flag;
 }
+void VerilatedContext::readmemThreads(uint32_t flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_readmemThreads = flag;
+}
 void VerilatedContext::profExecFilename(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_profExecFilename = flag;
@@ -3579,6 +4186,8 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         uint64_t u64;
         if (arg == "+verilator+assert+lock") {
             assertCtlsLocked(true);
+        } else if (arg == "+verilator+coverage+binary") {
+            coverageBinary(true);
         } else if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
             coverageFilename(str);
         } else if (arg == "+verilator+debug") {
@@ -3594,6 +4203,8 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
             VL_PRINTF_MT("For help, please see 'verilator --help'\n");
             VL_FATAL_MT("COMMAND_LINE", 0, "",
                         "Exiting due to command line argument (not an error)");
+        } else if (arg == "+verilator+log+async") {
+            logAsync(true);
         } else if (commandArgVlString(arg, "+verilator+log+file+", str)) {
             logFilename(str);
             logOutputToFile(false /* append */);
@@ -3610,6 +4221,9 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
             profVltFilename(str);
         } else if (arg == "+verilator+quiet") {
             quiet(true);
+        } else if (commandArgVlUint64(arg, "+verilator+readmem+threads+", u64, 0,
+                                      std::numeric_limits<int>::max())) {
+            readmemThreads(static_cast<uint32_t>(u64));
         } else if (commandArgVlUint64(arg, "+verilator+rand+reset+", u64, 0, 2)) {
             randReset(static_cast<int>(u64));
         } else if (commandArgVlString(arg, "+verilator+solver+file+", str)) {
@@ -3717,8 +4331,15 @@ double VerilatedContext::statWallTimeSinceStart() const VL_MT_SAFE_EXCLUDES(m_mu
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_wallTimeStart.deltaTime();
 }
+uint64_t VerilatedContext::statCoroutineFramesAllocated() const VL_MT_SAFE {
+    return m_ns.m_coroutineFramesAllocated.load(std::memory_order_relaxed);
+}
+uint64_t VerilatedContext::statCoroutineFramesReused() const VL_MT_SAFE {
+    return m_ns.m_coroutineFramesReused.load(std::memory_order_relaxed);
+}
 void VerilatedContext::statsPrintSummary() VL_MT_UNSAFE {
     if (quiet()) return;
+    VerilatedLogSink::drain();
     VL_PRINTF("- S i m u l a t i o n   R e p o r t: %s %s\n", Verilated::productName(),
               Verilated::productVersion());
     const std::string endwhy = gotError() ? "$stop" : gotFinish() ? "$finish" : "end";
@@ -3756,21 +4377,27 @@ void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at construction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    if (it == m_impdatap->m_nameMap.end()) {
+        m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+        m_impdatap->m_nameIndex.emplace(scopep->name(), scopep);
+    }
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     VerilatedImp::userEraseScope(scopep);
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    if (it != m_impdatap->m_nameMap.end()) {
+        m_impdatap->m_nameMap.erase(it);
+        m_impdatap->m_nameIndex.erase(scopep->name());
+    }
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     // If too slow, can assume this is only VL_MT_SAFE_POSINIT
-    const auto& it = m_impdatap->m_nameMap.find(namep);
-    if (VL_UNLIKELY(it == m_impdatap->m_nameMap.end())) return nullptr;
+    const auto& it = m_impdatap->m_nameIndex.find(namep);
+    if (VL_UNLIKELY(it == m_impdatap->m_nameIndex.end())) return nullptr;
     return it->second;
 }
 const VerilatedScopeNameMap* VerilatedContext::scopeNameMap() VL_MT_SAFE {
@@ -3910,6 +4537,7 @@ void Verilated::runFlushCallbacks() VL_MT_SAFE {
         runCallbacks(VlCbStatic.s_flushCbs);
     }
     --s_recursing;
+    VerilatedLogSink::drain();
     std::fflush(stderr);
     std::fflush(stdout);
     // When running internal code coverage (gcc --coverage, as opposed to
@@ -4162,8 +4790,7 @@ VerilatedVar* VerilatedScope::varInsert(const char* namep, void* datap, bool isP
     }
     va_end(ap);
 
-    m_varsp->emplace(namep, std::move(var));
-    return &(m_varsp->find(namep)->second);
+    return m_varsp->insertIndexed(namep, std::move(var));
 }
 
 void VerilatedScope::varsInsertFromTable(const VlVarTableEntry* entp, size_t n,
@@ -4193,7 +4820,7 @@ void VerilatedScope::varsInsertFromTable(const VlVarTableEntry* entp, size_t n,
             for (int d = 0; d < e.pdims; ++d) packedSize *= var.m_packed[d].elements();
             var.m_packedDpi = VerilatedRange{packedSize - 1, 0};
         }
-        m_varsp->emplace(e.namep, std::move(var));
+        m_varsp->insertIndexed(e.namep, std::move(var));
     }
 }
 
@@ -4227,8 +4854,7 @@ VerilatedVar* VerilatedScope::varInsertSized(const char* namep, void* datap, boo
     }
     va_end(ap);
 
-    m_varsp->emplace(namep, std::move(var));
-    return &(m_varsp->find(namep)->second);
+    return m_varsp->insertIndexed(namep, std::move(var));
 }
 
 VerilatedVar*
@@ -4291,16 +4917,12 @@ VerilatedScope::forceableVarInsert(const char* namep, void* datap, bool isParam,
     }
     va_end(ap);
 
-    m_varsp->emplace(namep, std::move(var));
-    return &(m_varsp->find(namep)->second);
+    return m_varsp->insertIndexed(namep, std::move(var));
 }
 
 // cppcheck-suppress unusedFunction  // Used by applications
 VerilatedVar* VerilatedScope::varFind(const char* namep) const VL_MT_SAFE_POSTINIT {
-    if (VL_LIKELY(m_varsp)) {
-        const auto it = m_varsp->find(namep);
-        if (VL_LIKELY(it != m_varsp->end())) return &(it->second);
-    }
+    if (VL_LIKELY(m_varsp)) return m_varsp->findIndexed(namep);
     return nullptr;
 }
 
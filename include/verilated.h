@@ -456,8 +456,13 @@ protected:
         bool m_executingFinal = false;  // Running generated final() code
         uint64_t m_profExecStart = 1;  // +prof+exec+start time
         uint32_t m_profExecWindow = 2;  // +prof+exec+window size
+        uint32_t m_readmemThreads = 0;  // +readmem+threads, 0 = available processors
+        std::atomic<uint64_t> m_coroutineFramesAllocated{0};  // Frames allocated from the heap
+        std::atomic<uint64_t> m_coroutineFramesReused{0};  // Frames reused from the frame pool
         // Slow path
         std::string m_coverageFilename;  // +coverage+file filename
+        bool m_coverageBinary = false;  // +coverage+binary
+        bool m_logAsync = false;  // +log+async
         std::string m_logFilename;  // +log+file filename
         std::string m_profExecFilename;  // +prof+exec+file filename
         std::string m_profVltFilename;  // +prof+vlt filename
@@ -602,6 +607,11 @@ public:
     bool quiet() const VL_MT_SAFE { return m_s.m_quiet; }
     /// Enable quiet (also prevents need for OS calls to get CPU time)
     void quiet(bool flag) VL_MT_SAFE;
+    /// Return if $display output is written by a background thread
+    bool logAsync() const VL_MT_SAFE;
+    /// Enable writing $display output to stdout from a background thread.
+    /// This applies to the whole process, as there is a single stdout.
+    void logAsync(bool flag) VL_MT_SAFE;
     /// Return randReset value
     int randReset() const VL_MT_SAFE { return m_s.m_randReset; }
     /// Select initial value of otherwise uninitialized signals.
@@ -618,6 +628,10 @@ public:
     double statCpuTimeSinceStart() const VL_MT_SAFE_EXCLUDES(m_mutex);
     /// Return statistic: Wall time delta from model created until now
     double statWallTimeSinceStart() const VL_MT_SAFE_EXCLUDES(m_mutex);
+    /// Return statistic: Coroutine frames allocated from the heap (--timing)
+    uint64_t statCoroutineFramesAllocated() const VL_MT_SAFE;
+    /// Return statistic: Coroutine frames reused from the frame pool (--timing)
+    uint64_t statCoroutineFramesReused() const VL_MT_SAFE;
     /// Print statistics summary (if not quiet)
     void statsPrintSummary() VL_MT_UNSAFE;
 
@@ -736,6 +750,8 @@ public:
     // Internal: coverage
     std::string coverageFilename() const VL_MT_SAFE;
     void coverageFilename(const std::string& flag) VL_MT_SAFE;
+    bool coverageBinary() const VL_MT_SAFE;
+    void coverageBinary(bool flag) VL_MT_SAFE;
 
     // Internal: logfile
     std::string logFilename() const VL_MT_SAFE;
@@ -759,6 +775,18 @@ public:
     std::string profVltFilename() const VL_MT_SAFE;
     void profVltFilename(const std::string& flag) VL_MT_SAFE;
 
+    // Internal: Coroutine frame statistics, counted by VlCoroutineFramePool
+    void coroutineFrameAllocatedInc() VL_MT_SAFE {
+        m_ns.m_coroutineFramesAllocated.fetch_add(1, std::memory_order_relaxed);
+    }
+    void coroutineFrameReusedInc() VL_MT_SAFE {
+        m_ns.m_coroutineFramesReused.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Internal: $readmem decode threads, 0 = available processors
+    uint32_t readmemThreads() const VL_MT_SAFE { return m_ns.m_readmemThreads; }
+    void readmemThreads(uint32_t flag) VL_MT_SAFE;
+
     // Internal: Solver log filename
     std::string solverLogFilename() const VL_MT_SAFE;
     void solverLogFilename(const std::string& flag) VL_MT_SAFE;
@@ -905,6 +933,7 @@ class Verilated final {
         // Fast path
         VerilatedContext* t_contextp = nullptr;  // Thread's context
         uint32_t t_mtaskId = 0;  // mtask# executing on this thread
+        uint32_t t_coverageShard = 0;  // Coverage counter shard, 0 unless a worker thread
         // Messages maybe pending on thread, needs end-of-eval calls
         uint32_t t_endOfEvalReqd = 0;
         const VerilatedScope* t_dpiScopep = nullptr;  // DPI context scope
@@ -1124,6 +1153,9 @@ public:
     // Per thread, so no need to be in VerilatedContext
     static uint32_t mtaskId() VL_MT_SAFE { return t_s.t_mtaskId; }
     static void mtaskId(uint32_t id) VL_MT_SAFE { t_s.t_mtaskId = id; }
+    // Internal: Coverage counter shard of this thread, set when a worker starts
+    static uint32_t coverageShard() VL_MT_SAFE { return t_s.t_coverageShard; }
+    static void coverageShard(uint32_t shard) VL_MT_SAFE { t_s.t_coverageShard = shard; }
     static void endOfEvalReqdInc() VL_MT_SAFE { ++t_s.t_endOfEvalReqd; }
     static void endOfEvalReqdDec() VL_MT_SAFE { --t_s.t_endOfEvalReqd; }
 
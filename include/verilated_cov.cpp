@@ -28,10 +28,12 @@
 #include "verilated.h"
 #include "verilated_cov_key.h"
 
+#include <algorithm>
 #include <deque>
 #include <fstream>
-#include <map>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 //=============================================================================
 // VerilatedCovConst
@@ -90,6 +92,36 @@ public:
     ~VerilatedCoverItemSpec() override = default;
 };
 
+//=============================================================================
+// VerilatedCoverItemShards
+// Coverage item whose counter has a copy in each per-thread shard
+
+class VerilatedCoverItemShards final : public VerilatedCovImpItem {
+private:
+    // MEMBERS
+    uint32_t* const m_countp;  // Count value in shard 0
+    const uint32_t m_shards;  // Number of shards
+    const size_t m_stride;  // Distance between shards, in counters
+public:
+    // METHODS
+    uint64_t count() const override {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < m_shards; ++i) sum += m_countp[i * m_stride];
+        return sum;
+    }
+    void zero() const override {
+        for (uint32_t i = 0; i < m_shards; ++i) m_countp[i * m_stride] = 0;
+    }
+    // CONSTRUCTORS
+    VerilatedCoverItemShards(uint32_t* countp, uint32_t shards, size_t stride)
+        : m_countp{countp}
+        , m_shards{shards}
+        , m_stride{stride} {
+        zero();
+    }
+    ~VerilatedCoverItemShards() override = default;
+};
+
 //=============================================================================
 // VerilatedCovImp
 //
@@ -101,8 +133,8 @@ public:
 class VerilatedCovImp final : public VerilatedCovContext {
 private:
     // TYPES
-    using ValueIndexMap = std::map<const std::string, int>;
-    using IndexValueMap = std::map<int, std::string>;
+    using ValueIndexMap = std::unordered_map<std::string, int>;
+    using IndexValueMap = std::vector<std::string>;  // Indexed by value index
     using ItemList = std::deque<VerilatedCovImpItem*>;
 
     // MEMBERS
@@ -137,7 +169,10 @@ private:
         ++m_nextIndex;
         assert(m_nextIndex > 0);  // Didn't rollover
         m_valueIndexes.emplace(value, m_nextIndex);
-        m_indexValues.emplace(m_nextIndex, value);
+        if (m_indexValues.size() <= static_cast<size_t>(m_nextIndex)) {
+            m_indexValues.resize(m_nextIndex + 1);
+        }
+        m_indexValues[m_nextIndex] = value;
         return m_nextIndex;
     }
     static std::string dequote(const std::string& text) VL_PURE {
@@ -370,45 +405,80 @@ public:
         const VerilatedLockGuard lock{m_mutex};
         selftest();
 
-        std::ofstream os{filename};
+        const bool binary = m_contextp->coverageBinary();
+        std::ofstream os{filename, binary ? std::ios::binary : std::ios::out};
         if (os.fail()) {
             const std::string msg = "%Error: Can't write '"s + filename + "'";
             VL_FATAL_MT("", 0, "", msg.c_str());
             return;
         }
-        os << "# SystemC::Coverage-3\n";
+
+        // Formatted text of each key and value, made once per index not per item
+        struct IndexText final {
+            bool m_done = false;
+            std::string m_key;  // Short key, if used as a key
+            std::string m_keyText;  // Key as written in a name
+            std::string m_valText;  // Value as written in a name
+        };
+        std::vector<IndexText> indexTexts(m_indexValues.size());
+        const auto indexText = [&](int index) -> const IndexText& {
+            IndexText& text = indexTexts[index];
+            if (!text.m_done) {
+                text.m_done = true;
+                const std::string& value = m_indexValues[index];
+                text.m_key = VerilatedCovKey::shortKey(value);
+                text.m_keyText = (text.m_key.length() == 1 && std::isalpha(text.m_key[0]))
+                                     ? text.m_key
+                                     : dequote(text.m_key);
+                text.m_valText = dequote(value);
+            }
+            return text;
+        };
 
         // Build list of events; totalize if collapsing hierarchy
-        std::map<const std::string, std::pair<std::string, uint64_t>> eventCounts;
+        struct EventCount final {
+            std::string m_hier;  // Hierarchy, combined if collapsing hierarchy
+            uint64_t m_count;  // Total count
+        };
+        using EventCounts = std::unordered_map<std::string, EventCount>;
+        EventCounts eventCounts;
+        eventCounts.reserve(m_items.size());
+        std::vector<EventCounts::value_type*> events;  // In order first seen
+        std::string name;
         for (const auto& itemp : m_items) {
-            std::string name;
-            std::string hier;
+            name.clear();
+            int hierIndex = VerilatedCovConst::KEY_UNDEF;
             bool per_instance = false;
             if (m_forcePerInstance) per_instance = true;
 
             for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
                 if (itemp->m_keys[i] != VerilatedCovConst::KEY_UNDEF) {
-                    const std::string key
-                        = VerilatedCovKey::shortKey(m_indexValues[itemp->m_keys[i]]);
-                    const std::string val = m_indexValues[itemp->m_vals[i]];
+                    const IndexText& keyText = indexText(itemp->m_keys[i]);
+                    const std::string& key = keyText.m_key;
+                    const std::string& val = m_indexValues[itemp->m_vals[i]];
                     if (key == VL_CIK_PER_INSTANCE) {
                         if (val != "0") per_instance = true;
                     }
                     if (key == VL_CIK_HIER) {
-                        hier = val;
+                        hierIndex = itemp->m_vals[i];
                     } else {
                         // Print it
                         if (key == "page") {
                             const std::string type = val.substr(2, val.find('/') - 2);
                             name += keyValueFormatter(VL_CIK_TYPE, type);
                         }
-                        name += keyValueFormatter(key, val);
+                        name += '\001';
+                        name += keyText.m_keyText;
+                        name += '\002';
+                        name += indexText(itemp->m_vals[i]).m_valText;
                     }
                 }
             }
+            // Index KEY_UNDEF's value is empty, for items without hierarchy
+            const std::string& hier = m_indexValues[hierIndex];
             if (per_instance) {  // Not collapsing hierarchies
-                name += keyValueFormatter(VL_CIK_HIER, hier);
-                hier = "";
+                name += "\001" VL_CIK_HIER "\002";
+                name += indexText(hierIndex).m_valText;
             }
 
             // Group versus point labels don't matter here, downstream
@@ -419,21 +489,52 @@ public:
             // Find or insert the named event
             const auto cit = eventCounts.find(name);
             if (cit != eventCounts.end()) {
-                const std::string& oldhier = cit->second.first;
-                cit->second.second += itemp->count();
-                cit->second.first = combineHier(oldhier, hier);
+                cit->second.m_count += itemp->count();
+                if (!per_instance) cit->second.m_hier = combineHier(cit->second.m_hier, hier);
             } else {
-                eventCounts.emplace(name, std::make_pair(hier, itemp->count()));
+                const auto pair = eventCounts.emplace(
+                    name, EventCount{per_instance ? "" : hier, itemp->count()});
+                events.push_back(&*pair.first);
             }
         }
 
-        // Output body
-        for (const auto& i : eventCounts) {
-            os << "C '" << std::dec;
-            os << i.first;
-            if (!i.second.first.empty()) os << keyValueFormatter(VL_CIK_HIER, i.second.first);
-            os << "' " << i.second.second;
-            os << '\n';
+        // Output body, buffered so the file is written in few large writes
+        constexpr size_t BUFFER_SIZE = 64 * 1024;
+        if (binary) {
+            VerilatedCovBinaryWriter writer;
+            for (const EventCounts::value_type* const eventp : events) {
+                name = eventp->first;
+                if (!eventp->second.m_hier.empty()) {
+                    name += keyValueFormatter(VL_CIK_HIER, eventp->second.m_hier);
+                }
+                writer.putPoint(name, eventp->second.m_count);
+                if (writer.buf().size() >= BUFFER_SIZE) {
+                    os.write(writer.buf().data(), writer.buf().size());
+                    writer.buf().clear();
+                }
+            }
+            os.write(writer.buf().data(), writer.buf().size());
+        } else {
+            std::sort(events.begin(), events.end(),
+                      [](const EventCounts::value_type* ap, const EventCounts::value_type* bp) {
+                          return ap->first < bp->first;
+                      });
+            std::string buf = "# SystemC::Coverage-3\n";
+            for (const EventCounts::value_type* const eventp : events) {
+                buf += "C '";
+                buf += eventp->first;
+                if (!eventp->second.m_hier.empty()) {
+                    buf += keyValueFormatter(VL_CIK_HIER, eventp->second.m_hier);
+                }
+                buf += "' ";
+                buf += std::to_string(eventp->second.m_count);
+                buf += '\n';
+                if (buf.size() >= BUFFER_SIZE) {
+                    os.write(buf.data(), buf.size());
+                    buf.clear();
+                }
+            }
+            os.write(buf.data(), buf.size());
         }
     }
 };
@@ -459,6 +560,10 @@ void VerilatedCovContext::_inserti(uint32_t* itemp) VL_MT_SAFE {
 void VerilatedCovContext::_inserti(uint64_t* itemp) VL_MT_SAFE {
     impp()->inserti(new VerilatedCoverItemSpec<uint64_t>{itemp});
 }
+void VerilatedCovContext::_inserti(uint32_t* itemp, uint32_t shards,
+                                   size_t stride) VL_MT_SAFE {
+    impp()->inserti(new VerilatedCoverItemShards{itemp, shards, stride});
+}
 void VerilatedCovContext::_insertf(const char* filename, int lineno) VL_MT_SAFE {
     impp()->insertf(filename, lineno);
 }
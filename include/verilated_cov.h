@@ -75,6 +75,35 @@ class VerilatedCovImp;
         ccontextp->_insertp("hier", name, __VA_ARGS__); \
     } while (false)
 
+/// Insert a coverage item whose count is split across per-thread shards.
+/// countp points at the item's counter in shard 0; the item's counter in
+/// shard n is at countp + n * stride.  Reported counts are the shard sum.
+#define VL_COVER_INSERT_SHARDS(covcontextp, name, countp, shards, stride, ...) \
+    do { \
+        auto const ccontextp = covcontextp; \
+        ccontextp->_inserti(countp, shards, stride); \
+        ccontextp->_insertf(__FILE__, __LINE__); \
+        ccontextp->_insertp("hier", name, __VA_ARGS__); \
+    } while (false)
+
+// Multithreaded models keep a row of counters per thread, so threads never
+// contend on the same cache line; rows are padded by a cache line at the end.
+// Return the row for the current thread.  Threads beyond the row count (worker
+// threads of a context shared with other models) fold onto the worker rows.
+template <std::size_t N_Shards, std::size_t N_Row>
+inline std::atomic<uint32_t>* VL_COV_SHARD(std::atomic<uint32_t> (&countsp)[N_Shards][N_Row])
+    VL_MT_SAFE {
+    static_assert(N_Shards > 1, "Sharded coverage requires multiple threads");
+    uint32_t shard = Verilated::coverageShard();
+    if (VL_UNLIKELY(shard >= N_Shards)) shard = 1 + (shard - 1) % (N_Shards - 1);
+    return countsp[shard];
+}
+// Return the distance in counters between a counter and its copy in the next shard
+template <std::size_t N_Shards, std::size_t N_Row>
+constexpr std::size_t VL_COV_SHARD_STRIDE(std::atomic<uint32_t> (&)[N_Shards][N_Row]) {
+    return N_Row;
+}
+
 inline void VL_COV_TOGGLE_CHG_ST_I(const int width, uint32_t* covp, const IData newData,
                                    const IData oldData) {
     const IData chgData = newData ^ oldData;
@@ -175,6 +204,8 @@ public:
     // _insert1: Remember item pointer with count.  (Not const, as may add zeroing function)
     void _inserti(uint32_t* itemp) VL_MT_SAFE;
     void _inserti(uint64_t* itemp) VL_MT_SAFE;
+    // _insert1 for a counter split into shards, see VL_COVER_INSERT_SHARDS
+    void _inserti(uint32_t* itemp, uint32_t shards, size_t stride) VL_MT_SAFE;
     // _insert2: Set default filename and line number
     void _insertf(const char* filename, int lineno) VL_MT_SAFE;
     // _insert3: Set parameters
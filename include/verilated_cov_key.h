@@ -25,6 +25,8 @@
 #include "verilatedos.h"
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 //=============================================================================
 // Data used to edit below file, using vlcovgen
@@ -97,4 +99,123 @@ public:
     }
 };
 
+//=============================================================================
+// VerilatedCovBinary
+// Namespace-style static class for \internal use.
+// Binary coverage data format, written by the runtime and verilator_coverage.
+// After the magic bytes, each record starts with a tag.  A STRING record is
+// the string's length and bytes, and appends it to the string table.  A POINT
+// record is the number of strings in the point's name, their string table
+// indices, then the count.  Names are split before each \001, so fields
+// shared by many points are stored once.  All numbers are LEB128 varints.
+
+class VerilatedCovBinary final {
+public:
+    enum : uint8_t { REC_STRING = 0, REC_POINT = 1 };
+
+    // Leading bytes identifying a binary coverage file, ending in the format version
+    static const char* magic() VL_PURE { return "VLCOVB2\n"; }
+    static size_t magicSize() VL_PURE { return 8; }
+    // Leading bytes of a binary coverage file of any version
+    static const char* magicPrefix() VL_PURE { return "VLCOVB"; }
+    static size_t magicPrefixSize() VL_PURE { return 6; }
+
+    static void putVarint(std::string& out, uint64_t value) VL_MT_SAFE {
+        while (value >= 0x80) {
+            out += static_cast<char>((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        out += static_cast<char>(value);
+    }
+    // Decode a varint at cp; return pointer after it, or nullptr if malformed
+    static const char* getVarint(const char* cp, const char* endp, uint64_t& valuer) VL_MT_SAFE {
+        uint64_t value = 0;
+        for (int shift = 0; cp < endp && shift < 64; shift += 7) {
+            const uint8_t byte = static_cast<uint8_t>(*cp++);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                valuer = value;
+                return cp;
+            }
+        }
+        return nullptr;
+    }
+};
+
+//=============================================================================
+// VerilatedCovBinaryWriter
+// Encode points in the VerilatedCovBinary format, for \internal use.
+
+class VerilatedCovBinaryWriter final {
+    std::unordered_map<std::string, uint64_t> m_strings;  // String table indices
+    std::string m_buf{VerilatedCovBinary::magic()};  // Encoded data not yet taken by caller
+    std::string m_part;  // Scratch name part
+    std::vector<uint64_t> m_partIndexes;  // Scratch name part string indices
+
+public:
+    // Encoded data; caller writes and clears it as needed
+    std::string& buf() VL_MT_UNSAFE { return m_buf; }
+    void putPoint(const std::string& name, uint64_t count) VL_MT_UNSAFE {
+        m_partIndexes.clear();
+        for (size_t start = 0; start < name.size();) {
+            size_t end = name.find('\001', start + 1);
+            if (end == std::string::npos) end = name.size();
+            m_part.assign(name, start, end - start);
+            const auto it = m_strings.find(m_part);
+            if (it != m_strings.end()) {
+                m_partIndexes.push_back(it->second);
+            } else {
+                const uint64_t index = m_strings.size();
+                m_strings.emplace(m_part, index);
+                VerilatedCovBinary::putVarint(m_buf, VerilatedCovBinary::REC_STRING);
+                VerilatedCovBinary::putVarint(m_buf, m_part.size());
+                m_buf += m_part;
+                m_partIndexes.push_back(index);
+            }
+            start = end;
+        }
+        VerilatedCovBinary::putVarint(m_buf, VerilatedCovBinary::REC_POINT);
+        VerilatedCovBinary::putVarint(m_buf, m_partIndexes.size());
+        for (const uint64_t index : m_partIndexes) VerilatedCovBinary::putVarint(m_buf, index);
+        VerilatedCovBinary::putVarint(m_buf, count);
+    }
+};
+
+//=============================================================================
+// VerilatedCovBinaryReader
+// Decode points in the VerilatedCovBinary format, for \internal use.
+
+class VerilatedCovBinaryReader final {
+    std::vector<std::string> m_strings;  // String table
+
+public:
+    // Decode records at cp through the next point, which is placed in namer
+    // and countr.  Return pointer after the point, or nullptr if malformed.
+    const char* getPoint(const char* cp, const char* endp, std::string& namer,
+                         uint64_t& countr) VL_MT_UNSAFE {
+        while (true) {
+            uint64_t tag;
+            uint64_t size;
+            if (!(cp = VerilatedCovBinary::getVarint(cp, endp, tag))) return nullptr;
+            if (!(cp = VerilatedCovBinary::getVarint(cp, endp, size))) return nullptr;
+            if (tag == VerilatedCovBinary::REC_STRING) {
+                if (size > static_cast<uint64_t>(endp - cp)) return nullptr;
+                m_strings.emplace_back(cp, size);
+                cp += size;
+            } else if (tag == VerilatedCovBinary::REC_POINT) {
+                namer.clear();
+                for (uint64_t i = 0; i < size; ++i) {
+                    uint64_t index;
+                    if (!(cp = VerilatedCovBinary::getVarint(cp, endp, index))) return nullptr;
+                    if (index >= m_strings.size()) return nullptr;
+                    namer += m_strings[index];
+                }
+                return VerilatedCovBinary::getVarint(cp, endp, countr);
+            } else {
+                return nullptr;
+            }
+        }
+    }
+};
+
 #endif  // guard
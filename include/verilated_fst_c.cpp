@@ -76,7 +76,8 @@ void VerilatedFst::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     m_fst = new fst::Writer{filename};  // LCOV_EXCL_BR_LINE
     m_fst->setWriterPackType(fst::WriterPackType::LZ4);
     m_fst->setTimecale(int8_t(round(log10(timeRes()))));
-    // if (m_useFstWriterThread) fstWriterSetParallelMode(m_fst, 1);
+    // If requested, compress value change blocks in background threads
+    m_fst->setParallelFlush(m_parallelFlush);
     m_fst->setWriter("Generated by VerilatedFst");
     constDump(true);  // First dump must contain the const signals
     fullDump(true);  // First dump must be full for fst
@@ -111,6 +112,12 @@ void VerilatedFst::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
     if (m_fst) m_fst->flushValueChangeData();  // LCOV_EXCL_BR_LINE
 }
 
+void VerilatedFst::parallelFlush(unsigned maxPendingBlocks) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    m_parallelFlush = maxPendingBlocks;
+    if (m_fst) m_fst->setParallelFlush(m_parallelFlush);
+}
+
 void VerilatedFst::emitTimeChange(uint64_t timeui) {
     if (!timeui) m_fst->emitTimeChange(timeui);
     m_timeui = timeui;
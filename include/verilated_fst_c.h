@@ -59,6 +59,8 @@ private:
     vlFstHandle* m_symbolp = nullptr;  // same as m_code2symbol, but as an array
     char* m_strbufp = nullptr;  // String buffer long enough to hold maxBits() chars
     uint64_t m_timeui = 0;  // Time to emit, 0 = not needed
+    // Max value change blocks compressed in background threads, 0 = compress synchronously
+    unsigned m_parallelFlush = 0;
 
     // Prefixes to add to signal names/scope types
     std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
@@ -106,6 +108,8 @@ public:
     void flush() VL_MT_SAFE_EXCLUDES(m_mutex);
     // Return if file is open
     bool isOpen() const VL_MT_SAFE { return m_fst != nullptr; }
+    // Set max value change blocks compressed in background threads, 0 = synchronous
+    void parallelFlush(unsigned maxPendingBlocks) VL_MT_SAFE_EXCLUDES(m_mutex);
 
     //=========================================================================
     // Internal interface to Verilator generated code
@@ -267,6 +271,12 @@ public:
     }
     /// Flush dump
     void flush() VL_MT_SAFE { m_sptrace.flush(); }
+    /// Set the maximum number of value change blocks being compressed by
+    /// background threads while the simulation continues. Higher values
+    /// use more memory; 0 (default) compresses on the simulation thread.
+    void parallelFlush(unsigned maxPendingBlocks) VL_MT_SAFE {
+        m_sptrace.parallelFlush(maxPendingBlocks);
+    }
     /// Write one cycle of dump data
     /// Call with the current context's time just after eval'ed,
     /// e.g. ->dump(contextp->time())
@@ -28,6 +28,8 @@
 #error "verilated_funcs.h should only be included by verilated.h"
 #endif
 
+#include "verilated_intrinsics.h"
+
 #include <string>
 
 //=========================================================================
@@ -183,6 +185,53 @@ extern std::string VL_SFORMATF_N_NX(const char* formatp, int argc, ...) VL_MT_SA
 extern void VL_WRITEF_NX(const char* formatp, int argc, ...) VL_MT_SAFE;
 extern void VL_FWRITEF_NX(IData fpi, const char* formatp, int argc, ...) VL_MT_SAFE;
 
+// Formatting with a format string parsed at Verilation time; each conversion
+// is a method call taking its width and flags, with no varargs or reparsing
+class VlFormat final {
+    std::string m_out;  // Formatted so far
+
+public:
+    // Conversion flags
+    enum : int { F_SIGNED = 1, F_LEFT = 2, F_ZERO = 4 };
+
+    // METHODS
+    // Literal text
+    VlFormat& text(const char* textp) {
+        m_out += textp;
+        return *this;
+    }
+    // %m
+    VlFormat& scope(const char* modulep, const char* scopep) VL_MT_SAFE;
+    // %c
+    VlFormat& chr(QData ld) {
+        m_out += static_cast<char>(ld & 0xff);
+        return *this;
+    }
+    // %d, %b, %o, %h and %s of an lbits <= 64 value; width < 0 for no width
+    VlFormat& dec(int lbits, QData ld, int width, int flags) VL_MT_SAFE;
+    VlFormat& bin(int lbits, QData ld, int width, int flags) VL_MT_SAFE;
+    VlFormat& oct(int lbits, QData ld, int width, int flags) VL_MT_SAFE;
+    VlFormat& hex(int lbits, QData ld, int width, int flags) VL_MT_SAFE;
+    VlFormat& chars(int lbits, QData ld, int width, int flags) VL_MT_SAFE;
+    // %s of a string
+    VlFormat& str(const std::string& value, int width, int flags) VL_MT_SAFE;
+    // Take the result
+    std::string result() { return std::move(m_out); }
+
+private:
+    void pad(const std::string& digits, int width, int flags, char padChar) VL_MT_SAFE;
+};
+extern void VL_SFORMAT_S(int obits, CData& destr, const std::string& output) VL_MT_SAFE;
+extern void VL_SFORMAT_S(int obits, SData& destr, const std::string& output) VL_MT_SAFE;
+extern void VL_SFORMAT_S(int obits, IData& destr, const std::string& output) VL_MT_SAFE;
+extern void VL_SFORMAT_S(int obits, QData& destr, const std::string& output) VL_MT_SAFE;
+extern void VL_SFORMAT_S(int obits, EData* destp, const std::string& output) VL_MT_SAFE;
+inline void VL_SFORMAT_S(std::string& destr, std::string&& output) VL_MT_SAFE {
+    destr = std::move(output);
+}
+extern void VL_WRITEF_S(const std::string& output) VL_MT_SAFE;
+extern void VL_FWRITEF_S(IData fpi, const std::string& output) VL_MT_SAFE;
+
 extern void VL_STACKTRACE() VL_MT_SAFE;
 extern std::string VL_STACKTRACE_N() VL_MT_SAFE;
 extern IData VL_SYSTEM_IW(int lhswords, WDataInP const lhsp) VL_MT_SAFE;
@@ -433,6 +482,65 @@ VL_ATTR_ALWINLINE WDataOutP VL_MEMCPY_W(WDataOutP owp, WDataInP const iwp, int w
     return owp;
 }
 
+//===================================================================
+// INTERNAL: SIMD vectors of words, for wide operators
+// If VL_SIMD_WORDS is defined, wide operators process that many words per
+// step with the below, and the remaining words one by one.
+
+// clang-format off
+#if defined(VL_HAVE_AVX2)
+# define VL_SIMD_WORDS 8  // EData words per _vl_simd_t
+using _vl_simd_t = __m256i;
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_load(const EData* ip) VL_PURE {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ip));
+}
+VL_ATTR_ALWINLINE void _vl_simd_store(EData* op, _vl_simd_t v) VL_MT_SAFE {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(op), v);
+}
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_zero() VL_PURE { return _mm256_setzero_si256(); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_and(_vl_simd_t a, _vl_simd_t b) VL_PURE { return _mm256_and_si256(a, b); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_or(_vl_simd_t a, _vl_simd_t b) VL_PURE { return _mm256_or_si256(a, b); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_xor(_vl_simd_t a, _vl_simd_t b) VL_PURE { return _mm256_xor_si256(a, b); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_not(_vl_simd_t a) VL_PURE {
+    return _mm256_xor_si256(a, _mm256_set1_epi32(-1));
+}
+#elif defined(VL_HAVE_SSE2)
+# define VL_SIMD_WORDS 4  // EData words per _vl_simd_t
+using _vl_simd_t = __m128i;
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_load(const EData* ip) VL_PURE {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ip));
+}
+VL_ATTR_ALWINLINE void _vl_simd_store(EData* op, _vl_simd_t v) VL_MT_SAFE {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(op), v);
+}
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_zero() VL_PURE { return _mm_setzero_si128(); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_and(_vl_simd_t a, _vl_simd_t b) VL_PURE { return _mm_and_si128(a, b); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_or(_vl_simd_t a, _vl_simd_t b) VL_PURE { return _mm_or_si128(a, b); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_xor(_vl_simd_t a, _vl_simd_t b) VL_PURE { return _mm_xor_si128(a, b); }
+VL_ATTR_ALWINLINE _vl_simd_t _vl_simd_not(_vl_simd_t a) VL_PURE {
+    return _mm_xor_si128(a, _mm_set1_epi32(-1));
+}
+#endif
+// clang-format on
+
+#ifdef VL_SIMD_WORDS
+// Reduce the words of a vector with OR, or XOR into a single word
+VL_ATTR_ALWINLINE EData _vl_simd_redor(_vl_simd_t v) VL_PURE {
+    EData words[VL_SIMD_WORDS];
+    _vl_simd_store(words, v);
+    EData r = 0;
+    for (int i = 0; i < VL_SIMD_WORDS; ++i) r |= words[i];
+    return r;
+}
+VL_ATTR_ALWINLINE EData _vl_simd_redxor(_vl_simd_t v) VL_PURE {
+    EData words[VL_SIMD_WORDS];
+    _vl_simd_store(words, v);
+    EData r = 0;
+    for (int i = 0; i < VL_SIMD_WORDS; ++i) r ^= words[i];
+    return r;
+}
+#endif
+
 // Output clean
 // EMIT_RULE: VL_CLEAN:  oclean=clean; obits=lbits;
 #define VL_CLEAN_II(obits, lbits, lhs) ((lhs) & (VL_MASK_I(obits)))
@@ -712,7 +820,17 @@ inline IData VL_REDAND_IW(int lbits, WDataInP const lwp) VL_PURE {
 #define VL_REDOR_Q(lhs) ((lhs) != 0)
 inline IData VL_REDOR_W(int words, WDataInP const lwp) VL_PURE {
     EData equal = 0;
-    for (int i = 0; i < words; ++i) equal |= lwp[i];
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    if (words >= VL_SIMD_WORDS) {
+        _vl_simd_t v = _vl_simd_zero();
+        for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+            v = _vl_simd_or(v, _vl_simd_load(lwp.datap() + i));
+        }
+        equal = _vl_simd_redor(v);
+    }
+#endif
+    for (; i < words; ++i) equal |= lwp[i];
     return (equal != 0);
 }
 
@@ -778,8 +896,18 @@ inline IData VL_REDXOR_64(QData r) VL_PURE {
 #endif
 }
 inline IData VL_REDXOR_W(int words, WDataInP const lwp) VL_PURE {
-    EData r = lwp[0];
-    for (int i = 1; i < words; ++i) r ^= lwp[i];
+    EData r = 0;
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    if (words >= VL_SIMD_WORDS) {
+        _vl_simd_t v = _vl_simd_zero();
+        for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+            v = _vl_simd_xor(v, _vl_simd_load(lwp.datap() + i));
+        }
+        r = _vl_simd_redxor(v);
+    }
+#endif
+    for (; i < words; ++i) r ^= lwp[i];
     return VL_REDXOR_32(r);
 }
 
@@ -928,30 +1056,72 @@ inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
 // EMIT_RULE: VL_AND:  oclean=lclean||rclean; obits=lbits; lbits==rbits;
 inline WDataOutP VL_AND_W(int words, WDataOutP owp, WDataInP const lwp,
                           WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        const _vl_simd_t l = _vl_simd_load(lwp.datap() + i);
+        const _vl_simd_t r = _vl_simd_load(rwp.datap() + i);
+        _vl_simd_store(owp.datap() + i, _vl_simd_and(l, r));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_OR:   oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 inline WDataOutP VL_OR_W(int words, WDataOutP owp, WDataInP const lwp,
                          WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        const _vl_simd_t l = _vl_simd_load(lwp.datap() + i);
+        const _vl_simd_t r = _vl_simd_load(rwp.datap() + i);
+        _vl_simd_store(owp.datap() + i, _vl_simd_or(l, r));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_CHANGEXOR:  oclean=1; obits=32; lbits==rbits;
 inline IData VL_CHANGEXOR_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
     IData od = 0;
-    for (int i = 0; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    if (words >= VL_SIMD_WORDS) {
+        _vl_simd_t v = _vl_simd_zero();
+        for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+            const _vl_simd_t l = _vl_simd_load(lwp.datap() + i);
+            const _vl_simd_t r = _vl_simd_load(rwp.datap() + i);
+            v = _vl_simd_or(v, _vl_simd_xor(l, r));
+        }
+        od = _vl_simd_redor(v);
+    }
+#endif
+    for (; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
     return od;
 }
 // EMIT_RULE: VL_XOR:  oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 inline WDataOutP VL_XOR_W(int words, WDataOutP owp, WDataInP const lwp,
                           WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        const _vl_simd_t l = _vl_simd_load(lwp.datap() + i);
+        const _vl_simd_t r = _vl_simd_load(rwp.datap() + i);
+        _vl_simd_store(owp.datap() + i, _vl_simd_xor(l, r));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_NOT:  oclean=dirty; obits=lbits;
 inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
-    for (int i = 0; i < words; ++i) owp[i] = ~(lwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        _vl_simd_store(owp.datap() + i, _vl_simd_not(_vl_simd_load(lwp.datap() + i)));
+    }
+#endif
+    for (; i < words; ++i) owp[i] = ~(lwp[i]);
     return owp;
 }
 
@@ -973,9 +1143,7 @@ inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SA
 
 // Output clean, <lhs> AND <rhs> MUST BE CLEAN
 inline IData VL_EQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
-    EData nequal = 0;
-    for (int i = 0; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
-    return (nequal == 0);
+    return VL_CHANGEXOR_W(words, lwp, rwp) == 0;
 }
 
 template <std::size_t N_Words>
@@ -1177,14 +1345,16 @@ inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
 inline WDataOutP VL_MUL_W(int words, WDataOutP owp, WDataInP const lwp,
                           WDataInP const rwp) VL_MT_SAFE {
     for (int i = 0; i < words; ++i) owp[i] = 0;
+    // Schoolbook multiply, carrying along each row of partial products.
+    // Products above the output width are not needed, so each row stops there.
     for (int lword = 0; lword < words; ++lword) {
-        for (int rword = 0; rword < words; ++rword) {
-            QData mul = static_cast<QData>(lwp[lword]) * static_cast<QData>(rwp[rword]);
-            for (int qword = lword + rword; qword < words; ++qword) {
-                mul += static_cast<QData>(owp[qword]);
-                owp[qword] = (mul & 0xffffffffULL);
-                mul = (mul >> 32ULL) & 0xffffffffULL;
-            }
+        const QData lhs = lwp[lword];
+        QData carry = 0;
+        for (int qword = lword; qword < words; ++qword) {
+            // Cannot overflow: (2^32-1)^2 + 2 * (2^32-1) == 2^64-1
+            carry += lhs * static_cast<QData>(rwp[qword - lword]) + owp[qword];
+            owp[qword] = (carry & 0xffffffffULL);
+            carry >>= 32ULL;
         }
     }
     // Last output word is dirty
@@ -2517,8 +2687,15 @@ inline WDataOutP VL_SHIFTL_WWI(int obits, int, int, WDataOutP owp, WDataInP cons
         for (int i = 0; i < word_shift; ++i) owp[i] = 0;
         for (int i = word_shift; i < VL_WORDS_I(obits); ++i) owp[i] = lwp[i - word_shift];
     } else {
-        for (int i = 0; i < VL_WORDS_I(obits); ++i) owp[i] = 0;
-        _vl_insert_WW(owp, lwp, obits - 1, rd);
+        // Each output word is a funnel shift of two adjacent input words
+        const int words = VL_WORDS_I(obits);
+        const int nbitsonleft = VL_EDATASIZE - bit_shift;
+        for (int i = 0; i < word_shift; ++i) owp[i] = 0;
+        owp[word_shift] = lwp[0] << bit_shift;
+        for (int i = word_shift + 1; i < words; ++i) {
+            owp[i] = (lwp[i - word_shift] << bit_shift) | (lwp[i - word_shift - 1] >> nbitsonleft);
+        }
+        owp[words - 1] &= VL_MASK_E(obits);
     }
     return owp;
 }
@@ -2589,11 +2766,13 @@ inline WDataOutP VL_SHIFTR_WWI(int obits, int, int, WDataOutP owp, WDataInP cons
         const int nbitsonright = VL_EDATASIZE - loffset;  // bits that end up in lword (know
                                                           // loffset!=0) Middle words
         const int words = VL_WORDS_I(obits - rd);
-        for (int i = 0; i < words; ++i) {
-            owp[i] = lwp[i + word_shift] >> loffset;
-            const int upperword = i + word_shift + 1;
-            if (upperword < VL_WORDS_I(obits)) owp[i] |= lwp[upperword] << nbitsonright;
+        // All but the last word have an upper input word, so no check needed
+        for (int i = 0; i < words - 1; ++i) {
+            owp[i] = (lwp[i + word_shift] >> loffset) | (lwp[i + word_shift + 1] << nbitsonright);
         }
+        owp[words - 1] = lwp[words - 1 + word_shift] >> loffset;
+        const int upperword = words + word_shift;
+        if (upperword < VL_WORDS_I(obits)) owp[words - 1] |= lwp[upperword] << nbitsonright;
         for (int i = words; i < VL_WORDS_I(obits); ++i) owp[i] = 0;
     }
     return owp;
@@ -33,12 +33,14 @@
 #include "verilated_syms.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <deque>
 #include <limits>
 #include <map>
 #include <numeric>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <functional>
@@ -69,6 +71,9 @@ public:
     explicit VerilatedMsg(const std::function<void()>& cb)
         : m_mtaskId{Verilated::mtaskId()}
         , m_cb{cb} {}
+    VerilatedMsg(uint32_t mtaskId, const std::function<void()>& cb)
+        : m_mtaskId{mtaskId}
+        , m_cb{cb} {}
     ~VerilatedMsg() = default;
     VerilatedMsg(const VerilatedMsg&) = default;
     VerilatedMsg(VerilatedMsg&&) = default;
@@ -134,9 +139,51 @@ public:
     }
 };
 
-// Each thread has a local queue to build up messages until the end of the eval() call
+// Destination of text printed with VL_PRINTF_MT, once in eval order.  Normally
+// printed immediately with VL_PRINTF, but with +verilator+log+async handed to a
+// background thread that writes it to stdout.
+class VerilatedLogSink final {
+    // Text pending beyond this stalls printing until the writer catches up
+    static constexpr size_t MAX_PENDING = 16 * 1024 * 1024;
+
+    mutable VerilatedMutex m_mutex;  // Protects below
+    std::condition_variable_any m_cv;  // Signals text pending, or text written
+    std::string m_pending VL_GUARDED_BY(m_mutex);  // Text not yet taken by the writer
+    bool m_writing VL_GUARDED_BY(m_mutex) = false;  // Writer has text not yet written
+    bool m_shutdown VL_GUARDED_BY(m_mutex) = false;  // Writer is to exit once idle
+    std::atomic<bool> m_async{false};  // Writer thread running
+    std::thread m_thread;  // Writer thread
+
+    // CONSTRUCTORS
+    VerilatedLogSink() = default;
+    ~VerilatedLogSink() { stop(); }
+    VL_UNCOPYABLE(VerilatedLogSink);
+    static VerilatedLogSink& singleton() VL_MT_SAFE {
+        static VerilatedLogSink s_s;
+        return s_s;
+    }
+    // METHODS
+    void start() VL_MT_SAFE_EXCLUDES(m_mutex);
+    void stop() VL_MT_SAFE_EXCLUDES(m_mutex);
+    void writerMain() VL_MT_SAFE_EXCLUDES(m_mutex);
+
+public:
+    // Print text, from the eval thread so in eval order
+    static void print(const std::string& text) VL_MT_SAFE;
+    // Enable or disable writing from a background thread
+    static void async(bool flag) VL_MT_SAFE;
+    // Wait until all text printed so far is written, so that output not
+    // through the sink, e.g. VL_PRINTF, follows it
+    static void drain() VL_MT_SAFE;
+};
+
+// Each thread has a local queue to build up messages until the end of the eval() call.
+// Text printed with VL_PRINTF_MT is appended to a single pending message, so each
+// mtask posts its printing in one message rather than one per call.
 class VerilatedThreadMsgQueue final {
     std::queue<VerilatedMsg> m_queue;
+    std::string m_text;  // Text printed since the last message was queued
+    uint32_t m_textMtaskId = 0;  // MTask that printed m_text
 
 public:
     // CONSTRUCTORS
@@ -162,18 +209,45 @@ public:
             // No queueing, just do the action immediately
             msg.run();
         } else {
+            threadton().queueText();
             Verilated::endOfEvalReqdInc();
             threadton().m_queue.push(msg);  // Pass by value to copy the message into queue
         }
     }
+    // Add text to print, called by producer
+    static void postText(const std::string& text) VL_MT_SAFE {
+        const uint32_t mtaskId = Verilated::mtaskId();
+        if (mtaskId == 0) {
+            VerilatedLogSink::print(text);
+            return;
+        }
+        VerilatedThreadMsgQueue& q = threadton();
+        if (q.m_textMtaskId != mtaskId) q.queueText();
+        if (q.m_text.empty()) {
+            Verilated::endOfEvalReqdInc();
+            q.m_textMtaskId = mtaskId;
+        }
+        q.m_text += text;
+    }
     // Push all messages to the eval's queue
     static void flush(VerilatedEvalMsgQueue* evalMsgQp) VL_MT_SAFE {
+        threadton().queueText();
         while (!threadton().m_queue.empty()) {
             evalMsgQp->post(threadton().m_queue.front());
             threadton().m_queue.pop();
             Verilated::endOfEvalReqdDec();
         }
     }
+
+private:
+    // Move pending text into a message, already counted by endOfEvalReqd
+    void queueText() VL_MT_SAFE {
+        if (m_text.empty()) return;
+        m_queue.push(VerilatedMsg{m_textMtaskId, [text = std::move(m_text)]() {  //
+                                      VerilatedLogSink::print(text);
+                                  }});
+        m_text.clear();
+    }
 };
 
 // FILE* list constructed from a file-descriptor
@@ -205,8 +279,10 @@ class VerilatedContextImpData final {
 protected:
     // Map of <scope_name, scope pointer>
     // Used by scopeInsert, scopeFind, scopeErase, scopeNameMap
-    mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap
+    mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap and m_nameIndex
     VerilatedScopeNameMap m_nameMap VL_GUARDED_BY(m_nameMutex);
+    // Hashed index of m_nameMap, for scopeFind
+    VerilatedCStrIndex<const VerilatedScope*> m_nameIndex VL_GUARDED_BY(m_nameMutex);
 };
 
 //======================================================================
@@ -305,7 +381,10 @@ public:  // But only for verilated*.cpp
     void fdFlush(IData fdi) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
         const VerilatedLockGuard lock{m_fdMutex};
         const VerilatedFpList fdlist = fdToFpList(fdi);
-        for (const auto& i : fdlist) std::fflush(i);
+        for (const auto& i : fdlist) {
+            if (i == stdout) VerilatedLogSink::drain();  // Flush pending $display output too
+            std::fflush(i);
+        }
     }
     IData fdSeek(IData fdi, IData offset, IData origin) VL_MT_SAFE_EXCLUDES(m_fdMutex) {
         const VerilatedLockGuard lock{m_fdMutex};
@@ -325,6 +404,7 @@ public:  // But only for verilated*.cpp
         const VerilatedFpList fdlist = fdToFpList(fdi);
         for (const auto& i : fdlist) {
             if (VL_UNLIKELY(!i)) continue;
+            if (i == stdout) VerilatedLogSink::drain();
             (void)fwrite(output.c_str(), 1, output.size(), i);
         }
     }
@@ -341,6 +421,8 @@ public:  // But only for verilated*.cpp
             m_fdFree.push_back(idx);
         } else {
             // MCD case
+            // stdout is not closed, but pending $display output is written
+            if (fdi & 1) VerilatedLogSink::drain();
             // Starts at 1 to skip stdout
             fdi >>= 1;
             for (int i = 1; (fdi != 0) && (i < 31); i++, fdi >>= 1) {
@@ -23,15 +23,18 @@
 
 #include "verilated_random.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <streambuf>
+#include <unordered_map>
 
-// Diversity (scalar rand vars): tie each free bit to a random target via a
-//   boolean assumption literal, then force the bits with (check-sat-assuming).
+// Diversity (scalar rand vars): tie each free bit to a random target by
+//   assuming its boolean literal or the literal's negation (check-sat-assuming).
 //   If UNSAT, (get-unsat-assumptions) names the literals clashing with the
 //   feasible hard+soft base; drop one per round and recheck until SAT, which
 //   keeps the maximal set of bits compatible with the constraints. Only these
@@ -304,6 +307,33 @@ static VlRProcess& getSolver() {
     return s_solver;
 }
 
+// Incremental solver session.  The options, declarations and hard constraints
+// of the last flat solve stay asserted at the solver's outermost level, and
+// each solve works inside (push 1) and pops back out.  A following randomize()
+// whose base is identical, as when a class is randomized in a loop, then sends
+// only its per-call assertions instead of re-declaring everything.
+static std::string s_solverBase;  // Base loaded in the solver, empty when reset
+
+// Return the solver with base loaded, reusing the current session if it matches
+static std::iostream& getSolverSession(const std::string& base) {
+    VlRProcess& os = getSolver();
+    if (base == s_solverBase) return os;
+    if (!s_solverBase.empty()) os << "(reset)\n";
+    os << base;
+    s_solverBase = base;
+    return os;
+}
+
+// Return the solver with nothing loaded, ending any session
+static std::iostream& getSolverReset() {
+    VlRProcess& os = getSolver();
+    if (!s_solverBase.empty()) {
+        os << "(reset)\n";
+        s_solverBase.clear();
+    }
+    return os;
+}
+
 static std::string readUntilBalanced(std::istream& stream) {
     std::string result;
     std::string token;
@@ -474,6 +504,765 @@ static uint64_t readVarValueU64(const void* datap, int width) {
     return 0;
 }
 
+static void writeVarValueU64(void* datap, int width, uint64_t value) {
+    if (width <= VL_BYTESIZE) {
+        *static_cast<CData*>(datap) = static_cast<CData>(value);
+    } else if (width <= VL_SHORTSIZE) {
+        *static_cast<SData*>(datap) = static_cast<SData>(value);
+    } else if (width <= VL_IDATASIZE) {
+        *static_cast<IData*>(datap) = static_cast<IData>(value);
+    } else {
+        *static_cast<QData*>(datap) = value;
+    }
+}
+
+//======================================================================
+// VlRNativeSolver
+//
+// In-process solver for the constraint sets V3Randomize marks as simple:
+// scalar rand variables up to 64 bits under ranges, inside sets, enums and
+// linear relations.  The constraints are parsed from their SMT-LIB text into
+// a small term graph.  Each variable's value set, a list of unsigned ranges
+// plus fixed bits, is narrowed by the constraints comparing it against
+// constants or already chosen variables; a value is then sampled from it.  A
+// complete assignment is accepted only once every constraint evaluates true,
+// so anything outside the propagated forms is handled by rejection.  Texts
+// that do not parse, and sets not solved within a few attempts, are left to
+// the SMT solver.
+
+class VlRNativeSolver final {
+    // TYPES
+    enum Op : uint8_t {
+        CONST,
+        VAR,
+        IMPLIES,
+        ITE,
+        EQ,
+        ULT,
+        ULE,
+        SLT,
+        SLE,
+        BVNOT,
+        BVNEG,
+        BVAND,
+        BVOR,
+        BVXOR,
+        BVXNOR,
+        BVADD,
+        BVSUB,
+        BVMUL,
+        BVUDIV,
+        BVUREM,
+        BVSDIV,
+        BVSMOD,
+        BVSHL,
+        BVLSHR,
+        BVASHR,
+        EXTRACT,
+        CONCAT,
+        ZEXT,
+        SEXT
+    };
+    struct Term final {
+        Op m_op;
+        int m_width;  // Result width, 1 for booleans
+        uint64_t m_value = 0;  // CONST value, VAR index, or EXTRACT low bit
+        int m_args[3] = {-1, -1, -1};  // Operand term indices
+    };
+    struct Var final {
+        int m_width;
+        uint64_t m_value;  // Current value, then the solution
+        bool m_fixed;  // Not randomized, keeps its current value
+    };
+    struct Constraint final {
+        int m_term;
+        std::vector<int> m_vars;  // Variables referenced, ascending
+    };
+    using Ranges = std::vector<std::pair<uint64_t, uint64_t>>;  // Sorted, disjoint, inclusive
+
+    static constexpr int ATTEMPTS = 64;  // Complete assignments tried before giving up
+    static constexpr int SAMPLES = 32;  // Samples per variable to meet its fixed bits
+    static constexpr size_t MAX_RANGES = 256;  // Ranges kept per variable
+
+    // MEMBERS
+    std::vector<Term> m_terms;
+    std::vector<Var> m_vars;
+    std::unordered_map<std::string, int> m_varIdx;  // Variable index by SMT name
+    std::vector<Constraint> m_hards;  // Top-level conjuncts of the hard constraints
+    std::vector<Constraint> m_softs;  // Top-level conjuncts of the soft constraints
+
+    // METHODS
+    static uint64_t mask(int width) {
+        return width >= 64 ? ~0ULL : ((1ULL << width) - 1);
+    }
+    static int64_t toSigned(uint64_t v, int width) {
+        if (width < 64 && (v >> (width - 1)) & 1) v |= ~mask(width);
+        return static_cast<int64_t>(v);
+    }
+    static bool msb(uint64_t v, int width) { return (v >> (width - 1)) & 1; }
+
+    int newTerm(Op op, int width, int arg0 = -1, int arg1 = -1, int arg2 = -1) {
+        if (width < 1 || width > 64) return -1;
+        Term term;
+        term.m_op = op;
+        term.m_width = width;
+        term.m_args[0] = arg0;
+        term.m_args[1] = arg1;
+        term.m_args[2] = arg2;
+        m_terms.push_back(term);
+        return static_cast<int>(m_terms.size() - 1);
+    }
+    int width(int t) const { return m_terms[t].m_width; }
+
+    // Parsing
+    static void skipSpace(const std::string& s, size_t& pos) {
+        while (pos < s.size() && std::isspace(static_cast<unsigned char>(s[pos]))) ++pos;
+    }
+    static std::string symbol(const std::string& s, size_t& pos) {
+        skipSpace(s, pos);
+        const size_t start = pos;
+        while (pos < s.size() && s[pos] != '(' && s[pos] != ')'
+               && !std::isspace(static_cast<unsigned char>(s[pos])))
+            ++pos;
+        return s.substr(start, pos - start);
+    }
+    static bool expect(const std::string& s, size_t& pos, char c) {
+        skipSpace(s, pos);
+        if (pos >= s.size() || s[pos] != c) return false;
+        ++pos;
+        return true;
+    }
+    static bool number(const std::string& str, uint64_t& valuer) {
+        if (str.empty() || str.size() > 20) return false;
+        valuer = 0;
+        for (const char c : str) {
+            if (!std::isdigit(static_cast<unsigned char>(c))) return false;
+            const uint64_t next = valuer * 10 + (c - '0');
+            if (next / 10 != valuer) return false;  // Overflow
+            valuer = next;
+        }
+        return true;
+    }
+    int parseConst(const std::string& sym) {
+        // #b and #x literals
+        const bool bin = sym.compare(0, 2, "#b") == 0;
+        if (!bin && sym.compare(0, 2, "#x") != 0) return -1;
+        const int digits = static_cast<int>(sym.size()) - 2;
+        const int w = bin ? digits : digits * 4;
+        if (w < 1 || w > 64) return -1;
+        uint64_t value = 0;
+        for (size_t i = 2; i < sym.size(); ++i) {
+            const char c = static_cast<char>(std::tolower(static_cast<unsigned char>(sym[i])));
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (!bin && c >= 'a' && c <= 'f') {
+                digit = c - 'a' + 10;
+            } else {
+                return -1;
+            }
+            if (bin && digit > 1) return -1;
+            value = (value << (bin ? 1 : 4)) | static_cast<uint64_t>(digit);
+        }
+        const int t = newTerm(CONST, w);
+        if (t >= 0) m_terms[t].m_value = value;
+        return t;
+    }
+    int parse(const std::string& s, size_t& pos) {
+        skipSpace(s, pos);
+        if (pos >= s.size() || s[pos] == ')') return -1;
+        if (s[pos] != '(') {
+            const std::string sym = symbol(s, pos);
+            if (sym[0] == '#') return parseConst(sym);
+            const auto it = m_varIdx.find(sym);
+            if (it == m_varIdx.end()) return -1;
+            const int t = newTerm(VAR, m_vars[it->second].m_width);
+            if (t >= 0) m_terms[t].m_value = it->second;
+            return t;
+        }
+        ++pos;
+        skipSpace(s, pos);
+        if (pos < s.size() && s[pos] == '(') {
+            // Indexed operator, ((_ extract h l) t), ((_ zero_extend n) t), ...
+            ++pos;
+            if (symbol(s, pos) != "_") return -1;
+            const std::string name = symbol(s, pos);
+            uint64_t n0 = 0;
+            uint64_t n1 = 0;
+            if (!number(symbol(s, pos), n0)) return -1;
+            if (name == "extract" && !number(symbol(s, pos), n1)) return -1;
+            if (!expect(s, pos, ')')) return -1;
+            const int a = parse(s, pos);
+            if (a < 0 || !expect(s, pos, ')')) return -1;
+            const uint64_t aw = width(a);
+            int t = -1;
+            if (name == "extract") {
+                if (n0 < n1 || n0 >= aw) return -1;
+                t = newTerm(EXTRACT, static_cast<int>(n0 - n1 + 1), a);
+                if (t >= 0) m_terms[t].m_value = n1;
+            } else if (name == "zero_extend" || name == "sign_extend") {
+                if (n0 > 64) return -1;
+                t = newTerm(name == "zero_extend" ? ZEXT : SEXT, static_cast<int>(aw + n0), a);
+            } else if (name == "repeat") {
+                if (n0 < 1 || n0 * aw > 64) return -1;
+                t = a;
+                for (uint64_t i = 1; i < n0; ++i) t = newTerm(CONCAT, width(t) + aw, t, a);
+            }
+            return t;
+        }
+        const std::string head = symbol(s, pos);
+        if (head == "_") {
+            // (_ bvN W) literal
+            const std::string valueStr = symbol(s, pos);
+            uint64_t value = 0;
+            uint64_t w = 0;
+            if (valueStr.compare(0, 2, "bv") != 0 || !number(valueStr.substr(2), value)
+                || !number(symbol(s, pos), w) || !expect(s, pos, ')'))
+                return -1;
+            if (w < 1 || w > 64 || (value & ~mask(static_cast<int>(w)))) return -1;
+            const int t = newTerm(CONST, static_cast<int>(w));
+            if (t >= 0) m_terms[t].m_value = value;
+            return t;
+        }
+        std::vector<int> args;
+        while (true) {
+            skipSpace(s, pos);
+            if (pos >= s.size()) return -1;
+            if (s[pos] == ')') {
+                ++pos;
+                break;
+            }
+            const int a = parse(s, pos);
+            if (a < 0) return -1;
+            args.push_back(a);
+        }
+        return newOp(head, args);
+    }
+    int newOp(const std::string& head, const std::vector<int>& args) {
+        const size_t n = args.size();
+        if (n == 0) return -1;
+        const int w0 = width(args[0]);
+        for (const int a : args) {
+            // All operands of the supported operators share a width, except
+            // ite's condition, concat and the shifts' amount
+            if (width(a) != w0 && head != "ite" && head != "concat") return -1;
+        }
+        // Booleans are represented as one bit vectors
+        if (head == "__Vbv" || head == "__Vbool") return n == 1 && w0 == 1 ? args[0] : -1;
+        if (n == 1) {
+            if (head == "not") return w0 == 1 ? newTerm(BVNOT, 1, args[0]) : -1;
+            if (head == "bvnot") return newTerm(BVNOT, w0, args[0]);
+            if (head == "bvneg") return newTerm(BVNEG, w0, args[0]);
+            return -1;
+        }
+        if (head == "ite") {
+            if (n != 3 || w0 != 1 || width(args[1]) != width(args[2])) return -1;
+            return newTerm(ITE, width(args[1]), args[0], args[1], args[2]);
+        }
+        if (head == "and" || head == "or" || head == "xor" || head == "bvand" || head == "bvor"
+            || head == "bvxor") {
+            // Variadic, fold left
+            if ((head[0] != 'b') && w0 != 1) return -1;
+            const Op op = (head == "and" || head == "bvand") ? BVAND
+                          : (head == "or" || head == "bvor") ? BVOR
+                                                             : BVXOR;
+            int t = args[0];
+            for (size_t i = 1; i < n && t >= 0; ++i) t = newTerm(op, w0, t, args[i]);
+            return t;
+        }
+        if (n != 2) return -1;
+        const int a = args[0];
+        const int b = args[1];
+        if (head == "=") return newTerm(EQ, 1, a, b);
+        if (head == "=>") return w0 == 1 ? newTerm(IMPLIES, 1, a, b) : -1;
+        if (head == "bvult") return newTerm(ULT, 1, a, b);
+        if (head == "bvule") return newTerm(ULE, 1, a, b);
+        if (head == "bvugt") return newTerm(ULT, 1, b, a);
+        if (head == "bvuge") return newTerm(ULE, 1, b, a);
+        if (head == "bvslt") return newTerm(SLT, 1, a, b);
+        if (head == "bvsle") return newTerm(SLE, 1, a, b);
+        if (head == "bvsgt") return newTerm(SLT, 1, b, a);
+        if (head == "bvsge") return newTerm(SLE, 1, b, a);
+        if (head == "concat") return newTerm(CONCAT, w0 + width(b), a, b);
+        static const std::unordered_map<std::string, Op> s_binops{
+            {"bvxnor", BVXNOR}, {"bvadd", BVADD},   {"bvsub", BVSUB},   {"bvmul", BVMUL},
+            {"bvudiv", BVUDIV}, {"bvurem", BVUREM}, {"bvsdiv", BVSDIV}, {"bvsmod", BVSMOD},
+            {"bvshl", BVSHL},   {"bvlshr", BVLSHR}, {"bvashr", BVASHR}};
+        const auto it = s_binops.find(head);
+        if (it == s_binops.end()) return -1;
+        return newTerm(it->second, w0, a, b);
+    }
+
+    // Evaluation, SMT-LIB semantics
+    uint64_t eval(int t) const {
+        const Term& term = m_terms[t];
+        const int w = term.m_width;
+        const auto arg = [&](int i) { return eval(term.m_args[i]); };
+        switch (term.m_op) {
+        case CONST: return term.m_value;
+        case VAR: return m_vars[term.m_value].m_value;
+        case IMPLIES: return !arg(0) || arg(1);
+        case ITE: return arg(0) ? arg(1) : arg(2);
+        case EQ: return arg(0) == arg(1);
+        case ULT: return arg(0) < arg(1);
+        case ULE: return arg(0) <= arg(1);
+        case SLT: {
+            const int aw = width(term.m_args[0]);
+            return toSigned(arg(0), aw) < toSigned(arg(1), aw);
+        }
+        case SLE: {
+            const int aw = width(term.m_args[0]);
+            return toSigned(arg(0), aw) <= toSigned(arg(1), aw);
+        }
+        case BVNOT: return ~arg(0) & mask(w);
+        case BVNEG: return (0 - arg(0)) & mask(w);
+        case BVAND: return arg(0) & arg(1);
+        case BVOR: return arg(0) | arg(1);
+        case BVXOR: return arg(0) ^ arg(1);
+        case BVXNOR: return ~(arg(0) ^ arg(1)) & mask(w);
+        case BVADD: return (arg(0) + arg(1)) & mask(w);
+        case BVSUB: return (arg(0) - arg(1)) & mask(w);
+        case BVMUL: return (arg(0) * arg(1)) & mask(w);
+        case BVUDIV: return udiv(arg(0), arg(1), w);
+        case BVUREM: return urem(arg(0), arg(1));
+        case BVSDIV: return sdiv(arg(0), arg(1), w);
+        case BVSMOD: return smod(arg(0), arg(1), w);
+        case BVSHL: {
+            const uint64_t n = arg(1);
+            return n >= static_cast<uint64_t>(w) ? 0 : (arg(0) << n) & mask(w);
+        }
+        case BVLSHR: {
+            const uint64_t n = arg(1);
+            return n >= static_cast<uint64_t>(w) ? 0 : arg(0) >> n;
+        }
+        case BVASHR: {
+            const uint64_t n = arg(1);
+            const int64_t v = toSigned(arg(0), w);
+            return static_cast<uint64_t>(n >= static_cast<uint64_t>(w) ? (v < 0 ? -1 : 0)
+                                                                        : v >> n)
+                   & mask(w);
+        }
+        case EXTRACT: return (arg(0) >> term.m_value) & mask(w);
+        case CONCAT: {
+            const int bw = width(term.m_args[1]);
+            return (arg(0) << bw) | arg(1);
+        }
+        case ZEXT: return arg(0);
+        case SEXT: return static_cast<uint64_t>(toSigned(arg(0), width(term.m_args[0]))) & mask(w);
+        default: return 0;  // LCOV_EXCL_LINE
+        }
+    }
+    static uint64_t udiv(uint64_t a, uint64_t b, int w) { return b ? a / b : mask(w); }
+    static uint64_t urem(uint64_t a, uint64_t b) { return b ? a % b : a; }
+    static uint64_t sdiv(uint64_t a, uint64_t b, int w) {
+        const bool na = msb(a, w);
+        const bool nb = msb(b, w);
+        const uint64_t ua = na ? (0 - a) & mask(w) : a;
+        const uint64_t ub = nb ? (0 - b) & mask(w) : b;
+        const uint64_t q = udiv(ua, ub, w);
+        return na != nb ? (0 - q) & mask(w) : q;
+    }
+    static uint64_t smod(uint64_t a, uint64_t b, int w) {
+        const bool na = msb(a, w);
+        const bool nb = msb(b, w);
+        const uint64_t ua = na ? (0 - a) & mask(w) : a;
+        const uint64_t ub = nb ? (0 - b) & mask(w) : b;
+        const uint64_t u = urem(ua, ub);
+        if (u == 0 || na == nb) return na ? (0 - u) & mask(w) : u;
+        return (na ? b - u : u + b) & mask(w);
+    }
+
+    // Analysis
+    void collectVars(int t, std::vector<int>& varsr) const {
+        const Term& term = m_terms[t];
+        if (term.m_op == VAR) {
+            varsr.push_back(static_cast<int>(term.m_value));
+            return;
+        }
+        for (const int a : term.m_args) {
+            if (a >= 0) collectVars(a, varsr);
+        }
+    }
+    void addConjuncts(int t, std::vector<Constraint>& consr) {
+        const Term& term = m_terms[t];
+        if (term.m_op == BVAND && term.m_width == 1) {
+            addConjuncts(term.m_args[0], consr);
+            addConjuncts(term.m_args[1], consr);
+            return;
+        }
+        Constraint con;
+        con.m_term = t;
+        collectVars(t, con.m_vars);
+        std::sort(con.m_vars.begin(), con.m_vars.end());
+        con.m_vars.erase(std::unique(con.m_vars.begin(), con.m_vars.end()), con.m_vars.end());
+        consr.push_back(std::move(con));
+    }
+    bool known(int t, const std::vector<bool>& assigned) const {
+        const Term& term = m_terms[t];
+        if (term.m_op == VAR) return assigned[term.m_value];
+        for (const int a : term.m_args) {
+            if (a >= 0 && !known(a, assigned)) return false;
+        }
+        return true;
+    }
+    // Whether t is variable v, possibly zero extended
+    bool isVar(int t, int v) const {
+        while (m_terms[t].m_op == ZEXT) t = m_terms[t].m_args[0];
+        return m_terms[t].m_op == VAR && m_terms[t].m_value == static_cast<uint64_t>(v);
+    }
+
+    static void intersect(Ranges& ar, const Ranges& b) {
+        Ranges out;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < ar.size() && j < b.size()) {
+            const uint64_t lo = std::max(ar[i].first, b[j].first);
+            const uint64_t hi = std::min(ar[i].second, b[j].second);
+            if (lo <= hi) out.emplace_back(lo, hi);
+            if (ar[i].second < b[j].second) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        ar.swap(out);
+    }
+    static void unite(Ranges& ar, const Ranges& b) {
+        Ranges all = ar;
+        all.insert(all.end(), b.begin(), b.end());
+        std::sort(all.begin(), all.end());
+        ar.clear();
+        for (const auto& r : all) {
+            if (!ar.empty() && (ar.back().second == ~0ULL || r.first <= ar.back().second + 1)) {
+                ar.back().second = std::max(ar.back().second, r.second);
+            } else {
+                ar.push_back(r);
+            }
+        }
+    }
+    // Values up to vmask not within ranges
+    static Ranges complement(const Ranges& ranges, uint64_t vmask) {
+        Ranges out;
+        uint64_t next = 0;
+        for (const auto& r : ranges) {
+            if (r.first > next) out.emplace_back(next, r.first - 1);
+            if (r.second >= vmask) return out;
+            next = r.second + 1;
+        }
+        out.emplace_back(next, vmask);
+        return out;
+    }
+    // Unsigned values of a width w variable whose signed value is within [lo, hi]
+    static Ranges signedRanges(int64_t lo, int64_t hi, int w) {
+        Ranges out;
+        if (lo > hi) return out;
+        const uint64_t m = mask(w);
+        if (lo >= 0 || hi < 0) {
+            out.emplace_back(static_cast<uint64_t>(lo) & m, static_cast<uint64_t>(hi) & m);
+        } else {
+            out.emplace_back(0, static_cast<uint64_t>(hi));
+            out.emplace_back(static_cast<uint64_t>(lo) & m, m);
+        }
+        return out;
+    }
+    // If t holds exactly when variable v is within some ranges, given the
+    // assigned variables, return true and those ranges
+    bool varRanges(int t, int v, const std::vector<bool>& assigned, Ranges& outr) const {
+        const Term& term = m_terms[t];
+        const uint64_t vmask = mask(m_vars[v].m_width);
+        if (term.m_width == 1 && known(t, assigned)) {
+            outr.clear();
+            if (eval(t)) outr.emplace_back(0, vmask);
+            return true;
+        }
+        switch (term.m_op) {
+        case BVAND:
+        case BVOR: {
+            if (term.m_width != 1) return false;
+            Ranges b;
+            if (!varRanges(term.m_args[0], v, assigned, outr)
+                || !varRanges(term.m_args[1], v, assigned, b))
+                return false;
+            if (term.m_op == BVAND) {
+                intersect(outr, b);
+            } else {
+                unite(outr, b);
+            }
+            return outr.size() <= MAX_RANGES;
+        }
+        case BVNOT: {
+            if (term.m_width != 1) return false;
+            Ranges inner;
+            if (!varRanges(term.m_args[0], v, assigned, inner)) return false;
+            outr = complement(inner, vmask);
+            return outr.size() <= MAX_RANGES;
+        }
+        case IMPLIES: {
+            Ranges b;
+            if (!varRanges(term.m_args[0], v, assigned, outr)
+                || !varRanges(term.m_args[1], v, assigned, b))
+                return false;
+            outr = complement(outr, vmask);
+            unite(outr, b);
+            return outr.size() <= MAX_RANGES;
+        }
+        case ITE: {
+            // (cond and then) or (not cond and else)
+            if (term.m_width != 1) return false;
+            Ranges cond;
+            Ranges b;
+            if (!varRanges(term.m_args[0], v, assigned, cond)
+                || !varRanges(term.m_args[1], v, assigned, outr)
+                || !varRanges(term.m_args[2], v, assigned, b))
+                return false;
+            intersect(outr, cond);
+            intersect(b, complement(cond, vmask));
+            unite(outr, b);
+            return outr.size() <= MAX_RANGES;
+        }
+        case EQ:
+        case ULT:
+        case ULE:
+        case SLT:
+        case SLE: {
+            const int a = term.m_args[0];
+            const int b = term.m_args[1];
+            const bool varLeft = isVar(a, v) && known(b, assigned);
+            if (!varLeft && !(isVar(b, v) && known(a, assigned))) return false;
+            const int w = width(a);
+            const uint64_t c = eval(varLeft ? b : a);
+            outr.clear();
+            if (term.m_op == EQ) {
+                if (c <= vmask) outr.emplace_back(c, c);
+            } else if (term.m_op == ULT || term.m_op == ULE) {
+                // Bounds in the compared width, clamped to the variable
+                const bool strict = term.m_op == ULT;
+                uint64_t lo = 0;
+                uint64_t hi = mask(w);
+                if (varLeft) {
+                    if (strict && c == 0) return true;
+                    hi = strict ? c - 1 : c;
+                } else {
+                    if (strict && c == mask(w)) return true;
+                    lo = strict ? c + 1 : c;
+                }
+                if (lo <= vmask) outr.emplace_back(lo, std::min(hi, vmask));
+            } else {
+                if (!isVarExact(varLeft ? a : b, v)) return false;
+                const bool strict = term.m_op == SLT;
+                const int64_t sc = toSigned(c, w);
+                const int64_t smin = toSigned(1ULL << (w - 1), w);
+                const int64_t smax = static_cast<int64_t>(mask(w - 1));
+                int64_t lo = smin;
+                int64_t hi = smax;
+                if (varLeft) {
+                    if (strict && sc == smin) return true;
+                    hi = strict ? sc - 1 : sc;
+                } else {
+                    if (strict && sc == smax) return true;
+                    lo = strict ? sc + 1 : sc;
+                }
+                outr = signedRanges(lo, hi, w);
+            }
+            return true;
+        }
+        default: return false;
+        }
+    }
+    bool isVarExact(int t, int v) const {
+        return m_terms[t].m_op == VAR && m_terms[t].m_value == static_cast<uint64_t>(v);
+    }
+    // If t's value is target for exactly one value of variable v, given the
+    // assigned variables, return true and that value
+    bool solveFor(int t, int v, uint64_t target, const std::vector<bool>& assigned,
+                  uint64_t& valuer) const {
+        const Term& term = m_terms[t];
+        if (isVarExact(t, v)) {
+            valuer = target;
+            return true;
+        }
+        const int w = term.m_width;
+        switch (term.m_op) {
+        case ZEXT:
+            if (target & ~mask(width(term.m_args[0]))) return false;
+            return solveFor(term.m_args[0], v, target, assigned, valuer);
+        case BVNOT: return solveFor(term.m_args[0], v, ~target & mask(w), assigned, valuer);
+        case BVNEG: return solveFor(term.m_args[0], v, (0 - target) & mask(w), assigned, valuer);
+        case BVADD:
+        case BVSUB:
+        case BVXOR: {
+            const int a = term.m_args[0];
+            const int b = term.m_args[1];
+            if (known(b, assigned)) {
+                const uint64_t kb = eval(b);
+                const uint64_t next = term.m_op == BVADD   ? target - kb
+                                      : term.m_op == BVSUB ? target + kb
+                                                           : target ^ kb;
+                return solveFor(a, v, next & mask(w), assigned, valuer);
+            }
+            if (known(a, assigned)) {
+                const uint64_t ka = eval(a);
+                const uint64_t next = term.m_op == BVADD   ? target - ka
+                                      : term.m_op == BVSUB ? ka - target
+                                                           : target ^ ka;
+                return solveFor(b, v, next & mask(w), assigned, valuer);
+            }
+            return false;
+        }
+        default: return false;
+        }
+    }
+    // Bits of variable v fixed by t, as (= ((_ extract h l) v) c) or (= (bvand v m) c)
+    bool varBits(int t, int v, const std::vector<bool>& assigned, uint64_t& fixMaskr,
+                 uint64_t& fixValuer) const {
+        const Term& term = m_terms[t];
+        if (term.m_op != EQ) return false;
+        int a = term.m_args[0];
+        int b = term.m_args[1];
+        if (!known(b, assigned)) std::swap(a, b);
+        if (!known(b, assigned)) return false;
+        const uint64_t c = eval(b);
+        const Term& side = m_terms[a];
+        uint64_t bitsMask;
+        uint64_t bitsValue;
+        if (side.m_op == EXTRACT && isVarExact(side.m_args[0], v)) {
+            bitsMask = mask(side.m_width) << side.m_value;
+            bitsValue = c << side.m_value;
+        } else if (side.m_op == BVAND && isVarExact(side.m_args[0], v)
+                   && known(side.m_args[1], assigned)) {
+            bitsMask = eval(side.m_args[1]);
+            if (c & ~bitsMask) return false;  // Unsatisfiable, left to the SMT solver
+            bitsValue = c;
+        } else {
+            return false;
+        }
+        if ((fixValuer ^ bitsValue) & fixMaskr & bitsMask) return false;  // Conflict
+        fixMaskr |= bitsMask;
+        fixValuer |= bitsValue & bitsMask;
+        return true;
+    }
+
+    static uint64_t sample(VlRNG& rngr, const Ranges& ranges) {
+        // Ranges cover at most 2^64 values; the full range is special
+        if (ranges.size() == 1 && ranges[0].first == 0 && ranges[0].second == ~0ULL)
+            return VL_RANDOM_RNG_Q(rngr);
+        uint64_t total = 0;
+        for (const auto& r : ranges) total += r.second - r.first + 1;
+        uint64_t pick = total ? VL_RANDOM_RNG_Q(rngr) % total : VL_RANDOM_RNG_Q(rngr);
+        for (const auto& r : ranges) {
+            const uint64_t size = r.second - r.first + 1;
+            if (size == 0 || pick < size) return r.first + pick;
+            pick -= size;
+        }
+        return ranges.back().second;  // LCOV_EXCL_LINE
+    }
+    static bool contains(const Ranges& ranges, uint64_t value) {
+        for (const auto& r : ranges) {
+            if (value >= r.first && value <= r.second) return true;
+        }
+        return false;
+    }
+    bool chooseVar(VlRNG& rngr, int v, const std::vector<bool>& assigned,
+                   const std::vector<const Constraint*>& cons) {
+        Var& var = m_vars[v];
+        Ranges ranges{{0, mask(var.m_width)}};
+        uint64_t fixMask = 0;
+        uint64_t fixValue = 0;
+        for (const Constraint* const conp : cons) {
+            // Only constraints whose other variables are all chosen
+            bool usable = false;
+            bool ready = true;
+            for (const int cv : conp->m_vars) {
+                if (cv == v) {
+                    usable = true;
+                } else if (!assigned[cv]) {
+                    ready = false;
+                    break;
+                }
+            }
+            if (!usable || !ready) continue;
+            Ranges conRanges;
+            uint64_t value;
+            const Term& term = m_terms[conp->m_term];
+            if (varRanges(conp->m_term, v, assigned, conRanges)) {
+                intersect(ranges, conRanges);
+            } else if (term.m_op == EQ
+                       && ((known(term.m_args[1], assigned)
+                            && solveFor(term.m_args[0], v, eval(term.m_args[1]), assigned,
+                                        value))
+                           || (known(term.m_args[0], assigned)
+                               && solveFor(term.m_args[1], v, eval(term.m_args[0]), assigned,
+                                           value)))) {
+                if (value > mask(var.m_width)) return false;
+                intersect(ranges, Ranges{{value, value}});
+            } else {
+                varBits(conp->m_term, v, assigned, fixMask, fixValue);
+            }
+            if (ranges.empty()) return false;
+        }
+        for (int i = 0; i < SAMPLES; ++i) {
+            const uint64_t value = (sample(rngr, ranges) & ~fixMask) | fixValue;
+            if (contains(ranges, value)) {
+                var.m_value = value;
+                return true;
+            }
+        }
+        return false;
+    }
+    bool holds(const std::vector<Constraint>& cons) const {
+        for (const Constraint& con : cons) {
+            if (!eval(con.m_term)) return false;
+        }
+        return true;
+    }
+    bool attempt(VlRNG& rngr, bool withSofts) {
+        std::vector<const Constraint*> cons;
+        for (const Constraint& con : m_hards) cons.push_back(&con);
+        if (withSofts) {
+            for (const Constraint& con : m_softs) cons.push_back(&con);
+        }
+        std::vector<bool> assigned(m_vars.size(), false);
+        for (size_t v = 0; v < m_vars.size(); ++v) assigned[v] = m_vars[v].m_fixed;
+        for (size_t v = 0; v < m_vars.size(); ++v) {
+            if (assigned[v]) continue;
+            if (!chooseVar(rngr, static_cast<int>(v), assigned, cons)) return false;
+            assigned[v] = true;
+        }
+        return holds(m_hards) && (!withSofts || holds(m_softs));
+    }
+
+public:
+    // METHODS
+    // Register a variable, returns its index
+    int addVar(const std::string& name, int width, uint64_t value, bool fixed) {
+        const int idx = static_cast<int>(m_vars.size());
+        m_vars.push_back(Var{width, value, fixed});
+        m_varIdx.emplace(name, idx);
+        return idx;
+    }
+    // Add a constraint, returns false if it is not in the supported subset
+    bool addConstraint(const std::string& smt, bool soft) {
+        size_t pos = 0;
+        const int t = parse(smt, pos);
+        if (t < 0 || width(t) != 1) return false;
+        skipSpace(smt, pos);
+        if (pos != smt.size()) return false;
+        addConjuncts(t, soft ? m_softs : m_hards);
+        return true;
+    }
+    // Whether the hard constraints hold for the current values
+    bool check() const { return holds(m_hards); }
+    // Find a solution, first honoring all soft constraints
+    bool solve(VlRNG& rngr) {
+        for (int i = 0; i < ATTEMPTS; ++i) {
+            if (attempt(rngr, true)) return true;
+        }
+        // Dropping softs one by one by priority is left to the SMT solver
+        return false;
+    }
+    uint64_t value(int idx) const { return m_vars[idx].m_value; }
+};
+
 void VlRandomizer::recordRandcValues() {
     for (const auto& name : m_randcVarNames) {
         const auto varIt = m_vars.find(name);
@@ -506,7 +1295,9 @@ bool VlRandomizer::nextRandomize(VlRNG& rngr, bool checkOnly) {
 
     // Pinned vars make phase ordering moot; skip phased path in check-only.
     bool result;
-    if (!m_checkOnly && !m_solveBefore.empty()) {
+    if (nativeEligible() && nextNative(rngr, result)) {
+        // Solved in-process
+    } else if (!m_checkOnly && !m_solveBefore.empty()) {
         result = nextPhased(rngr, uniqueExprs);
     } else {
         result = nextFlat(rngr, uniqueExprs);
@@ -515,6 +1306,57 @@ bool VlRandomizer::nextRandomize(VlRNG& rngr, bool checkOnly) {
     return result;
 }
 
+bool VlRandomizer::nativeEligible() const {
+    // randc cycling, unique arrays and solve-before ordering are left to the
+    // SMT solver, as are variables the native solver cannot represent
+    if (!m_nativeSolve || !m_randcVarNames.empty() || !m_unique_arrays.empty()) return false;
+    if (!m_checkOnly && !m_solveBefore.empty()) return false;
+    for (const auto& var : m_vars) {
+        if (var.second->dimension() > 0 || var.second->width() > VL_QUADSIZE) return false;
+    }
+    return true;
+}
+
+bool VlRandomizer::nextNative(VlRNG& rngr, bool& resultr) {
+    VlRNativeSolver solver;
+    std::vector<std::pair<const VlRandomVar*, int>> vars;
+    for (const auto& var : m_vars) {
+        const VlRandomVar& varr = *var.second;
+        const bool fixed = m_checkOnly || !varWritable(var.first, varr);
+        vars.emplace_back(&varr, solver.addVar(var.first, varr.width(),
+                                               readVarValueU64(varr.datap(0), varr.width()),
+                                               fixed));
+    }
+    for (const std::string& constraint : m_constraints) {
+        if (!solver.addConstraint(constraint, false)) return false;
+    }
+    if (m_checkOnly) {
+        // Soft constraints never make randomize(null) fail
+        resultr = solver.check();
+        return true;
+    }
+    for (const std::string& constraint : m_softConstraints) {
+        if (!solver.addConstraint(constraint, true)) return false;
+    }
+    if (!solver.solve(rngr)) return false;
+    for (const auto& var : vars) {
+        writeVarValueU64(var.first->datap(0), var.first->width(), solver.value(var.second));
+    }
+    resultr = true;
+    return true;
+}
+
+bool VlRandomizer::varWritable(const std::string& name, const VlRandomVar& varr) const {
+    if (!varr.randModeIdxNone()) {
+        // Static rand vars have their rand_mode in a class-package shared queue,
+        // not the per-instance one.
+        const VlQueue<CData>* const modep
+            = m_staticVars.count(name) ? m_static_randmodep : m_randmodep;
+        if (modep && !modep->at(varr.randModeIdx())) return false;
+    }
+    return !m_disabledVars.count(name);
+}
+
 std::vector<std::string> VlRandomizer::buildUniqueExprs() const {
     std::vector<std::string> exprs;
     if (m_unique_arrays.empty()) return exprs;
@@ -542,7 +1384,7 @@ void VlRandomizer::emitDefines(std::ostream& os) const {
     os << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
 }
 
-void VlRandomizer::emitDeclares(std::ostream& os, bool pinCurrent) const {
+void VlRandomizer::emitDeclares(std::ostream& os) const {
     for (const auto& var : m_vars) {
         if (var.second->dimension() > 0) {
             auto arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
@@ -551,13 +1393,16 @@ void VlRandomizer::emitDeclares(std::ostream& os, bool pinCurrent) const {
         os << "(declare-fun " << var.first << " () ";
         var.second->emitType(os);
         os << ")\n";
-        // Pin each var to its current value
-        if (pinCurrent) {
-            assert(var.second->dimension() == 0);
-            os << "(assert (= " << var.first << ' ';
-            var.second->emitConcreteValue(os);
-            os << "))\n";
-        }
+    }
+}
+
+void VlRandomizer::emitPinCurrent(std::ostream& os) const {
+    // Pin each var to its current value
+    for (const auto& var : m_vars) {
+        assert(var.second->dimension() == 0);
+        os << "(assert (= " << var.first << ' ';
+        var.second->emitConcreteValue(os);
+        os << "))\n";
     }
 }
 
@@ -581,30 +1426,37 @@ void VlRandomizer::emitAsserts(std::ostream& os, const std::vector<std::string>&
 }
 
 bool VlRandomizer::nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueExprs) {
+    // Everything independent of the current values and the RNG forms the
+    // session base; the rest is asserted in a pushed level on top of it
+    std::ostringstream base;
+    base << "(set-option :produce-models true)\n";
+    // Lets the scalar pin path learn which free-bit assumptions conflict.
+    base << "(set-option :produce-unsat-assumptions true)\n";
+    base << "(set-logic QF_ABV)\n";
+    emitDefines(base);
+    emitDeclares(base);
+    emitAsserts(base, uniqueExprs, false);
+    if (!hasArrayVars()) emitPinLiterals(base);
+
     // Randc retry: if unsat due to randc exhaustion, clear history and retry once
     const bool hasRandc = !m_randcVarNames.empty();
     for (int attempt = 0; attempt < (hasRandc ? 2 : 1); ++attempt) {
-        std::iostream& os = getSolver();
+        std::iostream& os = getSolverSession(base.str());
         if (!os) return false;
 
-        os << "(set-option :produce-models true)\n";
-        // Lets the scalar pin path learn which free-bit assumptions conflict.
-        os << "(set-option :produce-unsat-assumptions true)\n";
-        os << "(set-logic QF_ABV)\n";
-        emitDefines(os);
-        emitDeclares(os, m_checkOnly);
-        emitAsserts(os, uniqueExprs, false);
+        os << "(push 1)\n";
+        if (m_checkOnly) emitPinCurrent(os);
 
         // randc exclusions vs. a pinned current value would make every check
         // trivially UNSAT after the first cycle.
         if (!m_checkOnly) emitRandcExclusions(os);
 
-        relaxSoftConstraints(os);
+        const int softLevels = relaxSoftConstraints(os);
         os << "(check-sat)\n";
         const bool sat = parseSolution(os);
 
         if (!sat) {
-            os << "(reset)\n";
+            os << "(pop " << (1 + softLevels) << ")\n";
             // If randc vars have used values, this may be cycle exhaustion - retry
             if (hasRandc && !m_randcUsedValues.empty() && attempt == 0) {
                 m_randcUsedValues.clear();
@@ -615,7 +1467,7 @@ bool VlRandomizer::nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueE
             // the solver's free assignment.
             if (m_checkOnly) return false;
             // Genuine unsat: report via unsat-core
-            reportUnsatSetup(os, uniqueExprs);
+            reportUnsatSetup(getSolverReset(), uniqueExprs);
             os << "(reset)\n";
             return false;
         }
@@ -626,47 +1478,60 @@ bool VlRandomizer::nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueE
             recordRandcValues();
         }
 
-        os << "(reset)\n";
+        os << "(pop " << (1 + softLevels) << ")\n";
         return true;
     }
     return false;  // Should not reach here
 }
 
-void VlRandomizer::solveDiversity(VlRNG& rngr, std::iostream& os) {
-    bool hasArray = false;
+bool VlRandomizer::hasArrayVars() const {
     for (const auto& var : m_vars) {
-        if (var.second->dimension() > 0) {
-            hasArray = true;
-            break;
-        }
+        if (var.second->dimension() > 0) return true;
     }
-    if (hasArray) {
+    return false;
+}
+
+void VlRandomizer::solveDiversity(VlRNG& rngr, std::iostream& os) {
+    if (hasArrayVars()) {
         solveDiversityXor(rngr, os);
     } else {
         solveDiversityPins(rngr, os);
     }
 }
 
-void VlRandomizer::solveDiversityPins(VlRNG& rngr, std::iostream& os) {
-    // Tie each free bit to a random target via an assumption literal;
-    // drop one conflicting literal per round until compatible
+void VlRandomizer::emitPinLiterals(std::ostream& os) const {
+    // One literal per free bit, true when the bit is set; part of the session
+    // base, so each solve only picks the literal polarities to assume
     int npins = 0;
     for (const auto& var : m_vars) {
         const int w = var.second->totalWidth();
         for (int b = 0; b < w; ++b) {
-            const bool target = (VL_RANDOM_RNG_I(rngr) & 1);
             os << "(declare-fun a" << npins << " () Bool)\n";
             os << "(assert (= a" << npins << " (=";
             var.second->emitExtract(os, b);
-            os << " #b" << (target ? '1' : '0') << ")))\n";
+            os << " #b1)))\n";
             ++npins;
         }
     }
+}
+
+void VlRandomizer::solveDiversityPins(VlRNG& rngr, std::iostream& os) {
+    // Tie each free bit to a random target via an assumption literal;
+    // drop one conflicting literal per round until compatible
+    int npins = 0;
+    for (const auto& var : m_vars) npins += var.second->totalWidth();
+    std::vector<bool> targets(npins);
+    for (int k = 0; k < npins; ++k) targets[k] = (VL_RANDOM_RNG_I(rngr) & 1);
     std::vector<bool> dropped(npins, false);
     for (int round = 0; round <= npins; ++round) {
         os << "(check-sat-assuming (";
         for (int k = 0; k < npins; ++k) {
-            if (!dropped[k]) os << " a" << k;
+            if (dropped[k]) continue;
+            if (targets[k]) {
+                os << " a" << k;
+            } else {
+                os << " (not a" << k << ')';
+            }
         }
         os << "))\n";
         if (parseSolution(os)) return;
@@ -707,21 +1572,27 @@ bool VlRandomizer::checkSat(std::iostream& os) {
     return result == "sat";
 }
 
-void VlRandomizer::relaxSoftConstraints(std::iostream& os) {
+int VlRandomizer::relaxSoftConstraints(std::iostream& os) {
     // Re-add softs highest-priority first, dropping incompatible ones.
     const size_t nSoft = m_softConstraints.size();
-    if (nSoft == 0) return;
+    if (nSoft == 0) return 0;
     os << "(push 1)\n";
     for (const auto& s : m_softConstraints) os << "(assert (= #b1 " << s << "))\n";
     os << "(check-sat)\n";
-    if (checkSat(os)) return;
+    if (checkSat(os)) return 1;
     os << "(pop 1)\n";
+    int levels = 0;
     for (auto it = m_softConstraints.rbegin(); it != m_softConstraints.rend(); ++it) {
         os << "(push 1)\n";
         os << "(assert (= #b1 " << *it << "))\n";
         os << "(check-sat)\n";
-        if (!checkSat(os)) os << "(pop 1)\n";
+        if (checkSat(os)) {
+            ++levels;
+        } else {
+            os << "(pop 1)\n";
+        }
     }
+    return levels;
 }
 
 // Every complete run of digits in the reply, in order
@@ -754,7 +1625,7 @@ void VlRandomizer::reportUnsatSetup(std::iostream& os,
     os << "(set-option :produce-unsat-cores true)\n";
     os << "(set-logic QF_ABV)\n";
     emitDefines(os);
-    emitDeclares(os, false);
+    emitDeclares(os);
     emitAsserts(os, uniqueExprs, true);
     os << "(check-sat)\n";
     std::string status;
@@ -851,14 +1722,7 @@ bool VlRandomizer::parseSolution(std::iostream& os) {
         const auto it = m_vars.find(name);
         if (it == m_vars.end()) continue;
         const VlRandomVar& varr = *it->second;
-        if (!varr.randModeIdxNone()) {
-            // Static rand vars have their rand_mode in a class-package shared queue,
-            // not the per-instance one.
-            const VlQueue<CData>* const modep
-                = m_staticVars.count(name) ? m_static_randmodep : m_randmodep;
-            if (modep && !modep->at(varr.randModeIdx())) continue;
-        }
-        if (m_disabledVars.count(name)) continue;
+        if (!varWritable(name, varr)) continue;
         if (!indices.empty()) {
             std::ostringstream oss;
             oss << varr.name();
@@ -1029,13 +1893,13 @@ bool VlRandomizer::solvePhases(VlRNG& rngr, const std::vector<std::vector<std::s
     for (size_t phase = 0; phase < layers.size(); phase++) {
         const bool isFinalPhase = (phase == layers.size() - 1);
 
-        std::iostream& os = getSolver();
+        std::iostream& os = getSolverReset();
         if (!os) return false;
 
         os << "(set-option :produce-models true)\n";
         os << "(set-logic " << logicp << ")\n";
         emitDefines(os);
-        emitDeclares(os, false);
+        emitDeclares(os);
 
         for (const auto& entry : solvedValues) {
             os << "(assert (= " << entry.first << " " << entry.second << "))\n";
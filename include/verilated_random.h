@@ -254,13 +254,15 @@ class VlRandomizer VL_NOT_FINAL {
     std::vector<std::pair<std::string, std::string>>
         m_solveBefore;  // Solve-before ordering pairs (beforeVar, afterVar)
     bool m_checkOnly = false;  // Set for randomize(null)
+    bool m_nativeSolve = false;  // Constraints are in the native solver's subset
 
     // PRIVATE METHODS
     void randomConstraint(std::ostream& os, VlRNG& rngr, int bits);
     bool parseSolution(std::iostream& os);
     bool checkSat(std::iostream& os);
     // Assert the maximal compatible soft-constraint set onto the open session.
-    void relaxSoftConstraints(std::iostream& os);
+    // Returns the number of levels pushed to do so.
+    int relaxSoftConstraints(std::iostream& os);
     // Indices of the "a<N>" literals named by (get-unsat-assumptions).
     std::vector<int> readUnsatAssumptions(std::iostream& os);
     void reportUnsatSetup(std::iostream& os, const std::vector<std::string>& uniqueExprs);
@@ -269,13 +271,23 @@ class VlRandomizer VL_NOT_FINAL {
     void recordRandcValues();  // Record solved randc values for future exclusion
     size_t hashConstraints(const std::vector<std::string>& extras) const;
     bool nextRandomize(VlRNG& rngr, bool checkOnly);
+    // Whether to try the in-process solver before the SMT solver
+    bool nativeEligible() const;
+    // Solve in-process; returns false to fall back to the SMT solver
+    bool nextNative(VlRNG& rngr, bool& resultr);
+    // Whether solving may write the variable (rand_mode on, not disabled)
+    bool varWritable(const std::string& name, const VlRandomVar& varr) const;
     // "(distinct ...)" expression per unique-constrained array
     std::vector<std::string> buildUniqueExprs() const;
     void emitDefines(std::ostream& os) const;
-    void emitDeclares(std::ostream& os, bool pinCurrent) const;
+    void emitDeclares(std::ostream& os) const;
+    void emitPinCurrent(std::ostream& os) const;  // Assert each var equals its current value
     void emitAsserts(std::ostream& os, const std::vector<std::string>& extras, bool named) const;
     bool nextFlat(VlRNG& rngr, const std::vector<std::string>& uniqueExprs);
+    bool hasArrayVars() const;
     void solveDiversity(VlRNG& rngr, std::iostream& os);
+    // Declare the per-bit literals solveDiversityPins assumes
+    void emitPinLiterals(std::ostream& os) const;
     void solveDiversityPins(VlRNG& rngr, std::iostream& os);
     void solveDiversityXor(VlRNG& rngr, std::iostream& os);
     // Layers of solve...before variables in dependency order
@@ -700,6 +712,9 @@ public:
     void markRandc(const char* name);  // Mark variable as randc for cyclic tracking
     void solveBefore(const std::string& beforeName,
                      const std::string& afterName);  // Register solve-before ordering
+    // Constraints use only forms the in-process solver handles; set by
+    // Verilation when it can prove so, unsolved cases still reach the SMT solver
+    void nativeSolve(bool flag) { m_nativeSolve = flag; }
     void set_randmode(const VlQueue<CData>& randmode) { m_randmodep = &randmode; }
     // Shared across all instances; consulted instead of m_randmodep for vars marked via
     // mark_var_static().
@@ -59,44 +59,35 @@
 #undef VL_SUB_T
 #undef VL_BUF_T
 
-//=============================================================================
-// VerilatedSaifActivityBit
-
-class VerilatedSaifActivityBit final {
-    // MEMBERS
-    bool m_lastVal = false;  // Last emitted activity bit value
-    uint64_t m_highTime = 0;  // Total time when bit was high
-    size_t m_transitions = 0;  // Total number of bit transitions
-
-public:
-    // METHODS
-    VL_ATTR_ALWINLINE
-    void aggregateVal(uint64_t dt, bool newVal) {
-        m_transitions += newVal != m_lastVal ? 1 : 0;
-        m_highTime += m_lastVal ? dt : 0;
-        m_lastVal = newVal;
-    }
-
-    // ACCESSORS
-    VL_ATTR_ALWINLINE bool bitValue() const { return m_lastVal; }
-    VL_ATTR_ALWINLINE uint64_t highTime() const { return m_highTime; }
-    VL_ATTR_ALWINLINE uint64_t toggleCount() const { return m_transitions; }
-};
-
 //=============================================================================
 // VerilatedSaifActivityVar
+// Activity of all bits of a variable.  The last value is kept packed in
+// 64-bit words, so an update is one XOR per word, and only bits that
+// toggled are visited.  The per-bit counters are kept in separate arrays.
 
 class VerilatedSaifActivityVar final {
     // MEMBERS
-    uint64_t m_lastTime;  // Last time when variable value was updated
-    VerilatedSaifActivityBit* m_bits;  // Pointer to variable bits objects
-    uint32_t m_width;  // Width of variable (in bits)
+    uint64_t* m_lastValp = nullptr;  // Last emitted value, packed in 64-bit words
+    // Per bit, total time high, less the start time of the current high
+    // period if the bit is now high (modulo 2^64)
+    uint64_t* m_highTimep = nullptr;
+    uint64_t* m_togglesp = nullptr;  // Per bit, total number of transitions
+    uint32_t m_width = 0;  // Width of variable (in bits)
 
 public:
+    // Number of 64-bit value words for a variable of given width
+    static constexpr size_t valueWords(uint32_t width) {
+        return (width + VL_QUADSIZE - 1) / VL_QUADSIZE;
+    }
+    // Number of uint64_t of storage needed for a variable of given width
+    static constexpr size_t storageSize(uint32_t width) { return valueWords(width) + 2 * width; }
+
     // CONSTRUCTORS
-    VerilatedSaifActivityVar(uint64_t startTime, uint32_t width, VerilatedSaifActivityBit* bits)
-        : m_lastTime{startTime}
-        , m_bits{bits}
+    VerilatedSaifActivityVar() = default;
+    VerilatedSaifActivityVar(uint32_t width, uint64_t* storagep)
+        : m_lastValp{storagep}
+        , m_highTimep{storagep + valueWords(width)}
+        , m_togglesp{storagep + valueWords(width) + width}
         , m_width{width} {}
 
     VerilatedSaifActivityVar(VerilatedSaifActivityVar&&) = default;
@@ -110,22 +101,28 @@ public:
         static_assert(std::is_integral<DataType>::value,
                       "The emitted value must be of integral type");
 
-        const uint64_t dt = time - m_lastTime;
-        for (size_t i = 0; i < std::min(m_width, bits); ++i) {
-            m_bits[i].aggregateVal(dt, (newval >> i) & 1);
-        }
-        updateLastTime(time);
+        const uint64_t changed = (m_lastValp[0] ^ static_cast<uint64_t>(newval))
+                                 & VL_MASK_Q(std::min(m_width, bits));
+        if (changed) toggleWord(time, 0, changed);
     }
 
     VL_ATTR_ALWINLINE void emitWData(uint64_t time, WDataInP newval, uint32_t bits);
-    VL_ATTR_ALWINLINE void updateLastTime(uint64_t val) { m_lastTime = val; }
 
     // ACCESSORS
     VL_ATTR_ALWINLINE uint32_t width() const { return m_width; }
-    VL_ATTR_ALWINLINE VerilatedSaifActivityBit& bit(std::size_t index);
-    VL_ATTR_ALWINLINE uint64_t lastUpdateTime() const { return m_lastTime; }
+    VL_ATTR_ALWINLINE bool bitValue(std::size_t index) const {
+        return (m_lastValp[index / VL_QUADSIZE] >> VL_BITBIT_Q(index)) & 1;
+    }
+    // Total time bit was high, up to the given current time
+    VL_ATTR_ALWINLINE uint64_t highTime(std::size_t index, uint64_t time) const {
+        return m_highTimep[index] + (bitValue(index) ? time : 0);
+    }
+    VL_ATTR_ALWINLINE uint64_t toggleCount(std::size_t index) const { return m_togglesp[index]; }
 
 private:
+    // Record toggles of the 'changed' bits of value word 'wordIndex'
+    VL_ATTR_ALWINLINE void toggleWord(uint64_t time, std::size_t wordIndex, uint64_t changed);
+
     // CONSTRUCTORS
     VL_UNCOPYABLE(VerilatedSaifActivityVar);
 };
@@ -196,15 +193,20 @@ class VerilatedSaifActivityAccumulator final {
     // Map of scopes paths to codes of activities inside
     std::unordered_map<std::string, std::vector<std::pair<uint32_t, std::string>>>
         m_scopeToActivities;
-    // Map of variables codes mapped to their activity objects
-    std::unordered_map<uint32_t, VerilatedSaifActivityVar> m_activity;
-    // Memory pool for signals bits objects
-    std::vector<std::vector<VerilatedSaifActivityBit>> m_activityArena;
+    // Activity objects, indexed by variable code; width 0 if not declared
+    std::vector<VerilatedSaifActivityVar> m_activity;
+    // Memory pool for activity storage, in blocks of stable address
+    std::vector<std::vector<uint64_t>> m_activityArena;
 
 public:
     // METHODS
     void declare(uint32_t code, const std::string& absoluteScopePath, std::string variableName,
-                 int bits, bool array, int arraynum, uint64_t startTime);
+                 int bits, bool array, int arraynum);
+    VL_ATTR_ALWINLINE VerilatedSaifActivityVar& activity(uint32_t code) {
+        assert(code < m_activity.size() && m_activity[code].width()
+               && "Activity must be declared earlier");
+        return m_activity[code];
+    }
 
     // CONSTRUCTORS
     VerilatedSaifActivityAccumulator() = default;
@@ -221,29 +223,59 @@ private:
 //=============================================================================
 // VerilatedSaifActivityVar implementation
 
+// Index of the least significant set bit; word must be non-zero
+static inline int vlSaifLowestSetBit(uint64_t word) VL_PURE {
+#if defined(__GNUC__) && (__GNUC__ >= 4) && !defined(VL_NO_BUILTINS)
+    return __builtin_ctzll(static_cast<unsigned long long>(word));
+#else
+    int bit = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedSaifActivityVar::toggleWord(const uint64_t time, const std::size_t wordIndex,
+                                          uint64_t changed) {
+    const uint64_t newWord = m_lastValp[wordIndex] ^ changed;
+    m_lastValp[wordIndex] = newWord;
+    const std::size_t baseBit = wordIndex * VL_QUADSIZE;
+    // Visit each toggled bit, lowest first. Rising edges subtract the time
+    // and falling edges add it, so a low bit has its exact total high time.
+    for (; changed; changed &= changed - 1) {
+        const int bit = vlSaifLowestSetBit(changed);
+        const std::size_t index = baseBit + bit;
+        ++m_togglesp[index];
+        if ((newWord >> bit) & 1) {
+            m_highTimep[index] -= time;
+        } else {
+            m_highTimep[index] += time;
+        }
+    }
+}
+
 VL_ATTR_ALWINLINE
 void VerilatedSaifActivityVar::emitBit(const uint64_t time, const CData newval) {
-    assert(m_lastTime <= time);
-    m_bits[0].aggregateVal(time - m_lastTime, newval);
-    updateLastTime(time);
+    const uint64_t changed = (m_lastValp[0] ^ newval) & 1;
+    if (changed) toggleWord(time, 0, changed);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifActivityVar::emitWData(const uint64_t time, WDataInP newval,
                                          const uint32_t bits) {
-    assert(m_lastTime <= time);
-    const uint64_t dt = time - m_lastTime;
-    for (std::size_t i = 0; i < std::min(m_width, bits); ++i) {
-        const size_t wordIndex = i / VL_EDATASIZE;
-        m_bits[i].aggregateVal(dt, (newval[wordIndex] >> VL_BITBIT_E(i)) & 1);
+    const uint32_t width = std::min(m_width, bits);
+    const std::size_t words = VL_WORDS_I(width);
+    const std::size_t lastWord = valueWords(width) - 1;
+    for (std::size_t i = 0; i <= lastWord; ++i) {
+        uint64_t value = newval[2 * i];
+        if (2 * i + 1 < words) value |= static_cast<uint64_t>(newval[2 * i + 1]) << VL_EDATASIZE;
+        if (i == lastWord) value &= VL_MASK_Q(width - i * VL_QUADSIZE);
+        const uint64_t changed = m_lastValp[i] ^ value;
+        if (changed) toggleWord(time, i, changed);
     }
-
-    updateLastTime(time);
-}
-
-VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index) {
-    assert(index < m_width);
-    return m_bits[index];
 }
 
 //=============================================================================
@@ -253,15 +285,16 @@ VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index)
 
 void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string& absoluteScopePath,
                                                std::string variableName, int bits, bool array,
-                                               int arraynum, uint64_t startTime) {
+                                               int arraynum) {
     const size_t block_size = 1024;
+    const size_t size = VerilatedSaifActivityVar::storageSize(bits);
     if (m_activityArena.empty()
-        || m_activityArena.back().size() + bits > m_activityArena.back().capacity()) {
+        || m_activityArena.back().size() + size > m_activityArena.back().capacity()) {
         m_activityArena.emplace_back();
-        m_activityArena.back().reserve(block_size);
+        m_activityArena.back().reserve(std::max(block_size, size));
     }
-    const size_t bitsIdx = m_activityArena.back().size();
-    m_activityArena.back().resize(m_activityArena.back().size() + bits);
+    const size_t storageIdx = m_activityArena.back().size();
+    m_activityArena.back().resize(m_activityArena.back().size() + size);
 
     if (array) {
         variableName += '[';
@@ -269,8 +302,9 @@ void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string&
         variableName += ']';
     }
     m_scopeToActivities[absoluteScopePath].emplace_back(code, variableName);
-    m_activity.emplace(code, VerilatedSaifActivityVar{startTime, static_cast<uint32_t>(bits),
-                                                      m_activityArena.back().data() + bitsIdx});
+    if (m_activity.size() <= code) m_activity.resize(code + 1);
+    m_activity[code] = VerilatedSaifActivityVar{static_cast<uint32_t>(bits),
+                                                m_activityArena.back().data() + storageIdx};
 }
 
 //=============================================================================
@@ -377,7 +411,7 @@ bool VerilatedSaif::printScopeActivitiesFromAccumulatorIfPresent(
     if (accumulator.m_scopeToActivities.count(absoluteScopePath) == 0) return false;
 
     for (const auto& childSignal : accumulator.m_scopeToActivities.at(absoluteScopePath)) {
-        VerilatedSaifActivityVar& activityVariable = accumulator.m_activity.at(childSignal.first);
+        VerilatedSaifActivityVar& activityVariable = accumulator.activity(childSignal.first);
         anyNetWritten = printActivityStats(activityVariable, childSignal.second, anyNetWritten);
     }
 
@@ -399,9 +433,7 @@ void VerilatedSaif::closeNetScope() {
 bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
                                        const std::string& activityName, bool anyNetWritten) {
     for (size_t i = 0; i < activity.width(); ++i) {
-        VerilatedSaifActivityBit& bit = activity.bit(i);
-
-        bit.aggregateVal(currentTime() - activity.lastUpdateTime(), bit.bitValue());
+        const uint64_t highTime = activity.highTime(i, currentTime());
 
         if (!anyNetWritten) {
             openNetScope();
@@ -419,16 +451,14 @@ bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
 
         // We only have two-value logic so TZ, TX and TB will always be 0
         printStr(" (T0 ");
-        printStr(std::to_string(currentTime() - m_startTime - bit.highTime()));
+        printStr(std::to_string(currentTime() - m_startTime - highTime));
         printStr(") (T1 ");
-        printStr(std::to_string(bit.highTime()));
+        printStr(std::to_string(highTime));
         printStr(") (TZ 0) (TX 0) (TB 0) (TC ");
-        printStr(std::to_string(bit.toggleCount()));
+        printStr(std::to_string(activity.toggleCount(i)));
         printStr("))\n");
     }
 
-    activity.updateLastTime(currentTime());
-
     return anyNetWritten;
 }
 
@@ -546,7 +576,7 @@ void VerilatedSaif::declare(const uint32_t code, uint32_t fidx, const char* name
     m_currentScope->addActivityVar(code, variableName);
 
     accumulator.declare(code, m_currentScope->path(), std::move(variableName), bits, array,
-                        arraynum, m_startTime);
+                        arraynum);
 }
 
 // versions to call when the sig is not array member
@@ -626,55 +656,37 @@ void VerilatedSaifBuffer::emitEvent(const uint32_t code) {
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitBit(const uint32_t code, const CData newval) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
+    VerilatedSaifActivityVar& activity = m_owner.m_activityAccumulators[m_fidx]->activity(code);
     activity.emitBit(m_owner.currentTime(), newval);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitCData(const uint32_t code, const CData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
+    VerilatedSaifActivityVar& activity = m_owner.m_activityAccumulators[m_fidx]->activity(code);
     activity.emitData<CData>(m_owner.currentTime(), newval, bits);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitSData(const uint32_t code, const SData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
+    VerilatedSaifActivityVar& activity = m_owner.m_activityAccumulators[m_fidx]->activity(code);
     activity.emitData<SData>(m_owner.currentTime(), newval, bits);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitIData(const uint32_t code, const IData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
+    VerilatedSaifActivityVar& activity = m_owner.m_activityAccumulators[m_fidx]->activity(code);
     activity.emitData<IData>(m_owner.currentTime(), newval, bits);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitQData(const uint32_t code, const QData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
+    VerilatedSaifActivityVar& activity = m_owner.m_activityAccumulators[m_fidx]->activity(code);
     activity.emitData<QData>(m_owner.currentTime(), newval, bits);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitWData(const uint32_t code, WDataInP newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
+    VerilatedSaifActivityVar& activity = m_owner.m_activityAccumulators[m_fidx]->activity(code);
     activity.emitWData(m_owner.currentTime(), newval, bits);
 }
 
@@ -32,7 +32,6 @@ class VerilatedSaifBuffer;
 class VerilatedSaifActivityAccumulator;
 class VerilatedSaifActivityScope;
 class VerilatedSaifActivityVar;
-class VerilatedSaifActivityBit;
 
 //=============================================================================
 // VerilatedSaif
@@ -30,8 +30,12 @@
 #include "verilated.h"
 #include "verilated_imp.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <fcntl.h>
+#include <vector>
 
 // clang-format off
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
@@ -40,6 +44,14 @@
 # include <unistd.h>
 #endif
 
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+# define _VL_SAVE_FORK  // Allow pipe commands and forked saves.  Needs fork()
+#endif
+
+#ifdef _VL_SAVE_FORK
+# include <sys/wait.h>
+#endif
+
 #ifndef O_LARGEFILE  // WIN32 headers omit this
 # define O_LARGEFILE 0
 #endif
@@ -119,6 +131,77 @@ void VerilatedDeserialize::trailer() VL_MT_UNSAFE_ONE {
     }
 }
 
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// Processes
+
+#ifdef _VL_SAVE_FORK
+// Start "sh -c cmdp" with its standard input (if toCommand) or standard
+// output connected to the returned pipe descriptor, or return -1 on failure
+static int vl_save_pipe_open(const char* cmdp, bool toCommand,
+                             VlSavePid& pidr) VL_MT_UNSAFE_ONE {
+    int fds[2];  // Can't use std::array
+    if (VL_UNCOVERABLE(::pipe(fds) != 0)) return -1;  // LCOV_EXCL_LINE
+    const int childFd = toCommand ? fds[0] : fds[1];
+    const int parentFd = toCommand ? fds[1] : fds[0];
+    const pid_t pid = ::fork();
+    if (VL_UNCOVERABLE(pid < 0)) {
+        // LCOV_EXCL_START
+        ::close(fds[0]);
+        ::close(fds[1]);
+        return -1;
+        // LCOV_EXCL_STOP
+    }
+    if (pid == 0) {
+        // Child
+        ::dup2(childFd, toCommand ? STDIN_FILENO : STDOUT_FILENO);
+        ::close(childFd);
+        ::close(parentFd);
+        ::execl("/bin/sh", "sh", "-c", cmdp, static_cast<char*>(nullptr));
+        ::_exit(127);  // LCOV_EXCL_LINE
+    }
+    // Parent
+    ::close(childFd);
+    ::fcntl(parentFd, F_SETFD, FD_CLOEXEC);
+    pidr = pid;
+    return parentFd;
+}
+
+// Wait for a child process, return true if it exited successfully
+static bool vl_save_wait(pid_t pid) VL_MT_UNSAFE_ONE {
+    int status = 0;
+    while (::waitpid(pid, &status, 0) < 0) {
+        if (VL_UNCOVERABLE(errno != EINTR)) return false;  // LCOV_EXCL_LINE
+    }
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// Child processes from VerilatedSave::openForked that have not been waited for
+struct VlSaveForked final {
+    std::vector<pid_t> m_pids;  // Outstanding children
+    bool m_failed = false;  // A child that was waited for failed
+    static VlSaveForked& s() {
+        static VlSaveForked s_s;
+        return s_s;
+    }
+    // Reap children that have already finished, so they don't accumulate
+    void reapFinished() {
+        std::vector<pid_t> running;
+        for (const pid_t pid : m_pids) {
+            int status = 0;
+            const pid_t got = ::waitpid(pid, &status, WNOHANG);
+            if (got == 0) {
+                running.push_back(pid);
+            } else if (got != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                m_failed = true;
+            }
+        }
+        m_pids.swap(running);
+    }
+};
+#endif
+
 //=============================================================================
 //=============================================================================
 //=============================================================================
@@ -129,8 +212,16 @@ void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     if (isOpen()) return;
     VL_DEBUG_IF(VL_DBG_MSGF("- save: opening save file %s\n", filenamep););
 
-    if (VL_UNCOVERABLE(filenamep[0] == '|')) {
-        assert(0);  // LCOV_EXCL_LINE // Not supported yet.
+    if (filenamep[0] == '|') {
+        m_fd = -1;
+#ifdef _VL_SAVE_FORK
+        m_fd = vl_save_pipe_open(filenamep + 1, true, m_pid);
+#endif
+        if (VL_UNLIKELY(m_fd < 0)) {
+            // User code can check isOpen()
+            m_isOpen = false;
+            return;
+        }
     } else {
         // cppcheck-suppress duplicateExpression
         m_fd = ::open(filenamep,
@@ -152,8 +243,16 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     if (isOpen()) return;
     VL_DEBUG_IF(VL_DBG_MSGF("- restore: opening restore file %s\n", filenamep););
 
-    if (VL_UNCOVERABLE(filenamep[0] == '|')) {
-        assert(0);  // LCOV_EXCL_LINE // Not supported yet.
+    if (filenamep[0] == '|') {
+        m_fd = -1;
+#ifdef _VL_SAVE_FORK
+        m_fd = vl_save_pipe_open(filenamep + 1, false, m_pid);
+#endif
+        if (VL_UNLIKELY(m_fd < 0)) {
+            // User code can check isOpen()
+            m_isOpen = false;
+            return;
+        }
     } else {
         // cppcheck-suppress duplicateExpression
         m_fd = ::open(filenamep, O_CREAT | O_RDONLY | O_LARGEFILE | O_CLOEXEC, 0666);
@@ -170,12 +269,60 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     header();
 }
 
+void VerilatedSave::openForked(const char* filenamep) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+#ifdef _VL_SAVE_FORK
+    VlSaveForked::s().reapFinished();
+    // Else the child's exit on an error would repeat our pending output
+    std::fflush(nullptr);
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        // Child, owns a copy-on-write image of the model
+        m_forkedChild = true;
+        open(filenamep);
+        if (VL_UNLIKELY(!isOpen())) ::_exit(1);
+        return;
+    }
+    if (VL_LIKELY(pid > 0)) {
+        VL_DEBUG_IF(VL_DBG_MSGF("- save: forked %d to write %s\n", pid, filenamep););
+        VlSaveForked::s().m_pids.push_back(pid);
+        return;
+    }
+#endif
+    open(filenamep);  // No fork, so save synchronously
+}
+
+bool VerilatedSave::waitForked() VL_MT_UNSAFE_ONE {
+#ifdef _VL_SAVE_FORK
+    VlSaveForked& forked = VlSaveForked::s();
+    for (const pid_t pid : forked.m_pids) {
+        if (!vl_save_wait(pid)) forked.m_failed = true;
+    }
+    forked.m_pids.clear();
+    const bool ok = !forked.m_failed;
+    forked.m_failed = false;
+    return ok;
+#else
+    return true;
+#endif
+}
+
 void VerilatedSave::closeImp() VL_MT_UNSAFE_ONE {
     if (!isOpen()) return;
     trailer();
     flushImp();
     m_isOpen = false;
     ::close(m_fd);  // May get error, just ignore it
+#ifdef _VL_SAVE_FORK
+    if (m_pid) {
+        // Wait for the pipe command, so the saved file is complete on return
+        const bool ok = vl_save_wait(m_pid);
+        m_pid = 0;
+        if (VL_UNLIKELY(!ok)) fatal("Save pipe command failed: "s + m_filename);
+    }
+    if (m_forkedChild) ::_exit(0);
+#endif
 }
 
 void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
@@ -184,6 +331,48 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
     flushImp();
     m_isOpen = false;
     ::close(m_fd);  // May get error, just ignore it
+#ifdef _VL_SAVE_FORK
+    // Any pipe command error will have already failed the trailer check
+    if (m_pid) vl_save_wait(m_pid);
+    m_pid = 0;
+#endif
+}
+
+void VerilatedSaveMem::open() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    m_data.clear();
+    m_isOpen = true;
+    m_filename = "<memory>";
+    m_cp = m_bufp;
+    header();
+}
+
+void VerilatedRestoreMem::open(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    m_datap = datap;
+    m_dataEndp = datap + size;
+    m_isOpen = true;
+    m_filename = "<memory>";
+    m_cp = m_bufp;
+    m_endp = m_bufp;
+    header();
+}
+
+void VerilatedSaveMem::closeImp() VL_MT_UNSAFE_ONE {
+    if (!isOpen()) return;
+    trailer();
+    flushImp();
+    m_isOpen = false;
+}
+
+void VerilatedRestoreMem::closeImp() VL_MT_UNSAFE_ONE {
+    if (!isOpen()) return;
+    trailer();
+    flushImp();
+    m_isOpen = false;
+    m_datap = m_dataEndp = nullptr;
 }
 
 //=============================================================================
@@ -204,8 +393,7 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
             if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
                 // LCOV_EXCL_START
                 // write failed, presume error (perhaps out of disk space)
-                const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
-                VL_FATAL_MT("", 0, "", msg.c_str());
+                fatal(std::string{__FUNCTION__} + ": " + std::strerror(errno));
                 close();
                 break;
                 // LCOV_EXCL_STOP
@@ -215,6 +403,19 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_cp = m_bufp;  // Reset buffer
 }
 
+void VerilatedSave::fatal(const std::string& msg) VL_MT_UNSAFE_ONE {
+#ifdef _VL_SAVE_FORK
+    if (m_forkedChild) {
+        // The child of openForked() shares the parent's files, and has none of
+        // its threads, so must not run flush or exit callbacks, nor destructors
+        const std::string line = "%Error: "s + msg + "\n";
+        if (::write(STDERR_FILENO, line.data(), line.size()) < 0) {}  // Exiting anyways
+        ::_exit(1);
+    }
+#endif
+    VL_FATAL_MT("", 0, "", msg.c_str());
+}
+
 void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
@@ -250,6 +451,35 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     }
 }
 
+void VerilatedSaveMem::flushImp() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(!isOpen())) return;
+    m_data.insert(m_data.end(), m_bufp, m_cp);
+    m_cp = m_bufp;  // Reset buffer
+}
+
+void VerilatedRestoreMem::fill() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(!isOpen())) return;
+    // Move remaining characters down to start of buffer
+    const size_t remaining = m_endp - m_cp;
+    std::memmove(m_bufp, m_cp, remaining);
+    m_endp = m_bufp + remaining;
+    m_cp = m_bufp;  // Reset buffer
+    const size_t got = std::min<size_t>(m_bufp + bufferSize() - m_endp, m_dataEndp - m_datap);
+    std::memcpy(m_endp, m_datap, got);
+    m_endp += got;
+    m_datap += got;
+    // At end of data, pad with NULLs so readers need not check for EOF.
+    // Unlike a file, only pad what bufferCheck needs, as small restores
+    // would otherwise be dominated by clearing the buffer
+    if (m_datap == m_dataEndp) {
+        const size_t pad = std::min<size_t>(bufferInsertSize(), m_bufp + bufferSize() - m_endp);
+        std::memset(m_endp, 0, pad);
+        m_endp += pad;
+    }
+}
+
 //=============================================================================
 // Serialization of types
 
@@ -27,6 +27,15 @@
 #include "verilated.h"
 
 #include <string>
+#include <vector>
+
+// clang-format off
+#if defined(_WIN32) && defined(_MSC_VER)
+using VlSavePid = int;  // Process id, unused as there are no pipe commands
+#else
+using VlSavePid = pid_t;  // Process id
+#endif
+// clang-format on
 
 //=============================================================================
 // VerilatedSerialize
@@ -193,9 +202,12 @@ private:
 class VerilatedSave final : public VerilatedSerialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    VlSavePid m_pid = 0;  // Pipe command process id, or zero if writing a file
+    bool m_forkedChild = false;  // True if in the process created by openForked()
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE;
+    void fatal(const std::string& msg) VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
@@ -204,10 +216,28 @@ public:
     /// Flush, close and destruct
     ~VerilatedSave() override { closeImp(); }
     // METHODS
-    /// Open the file; call isOpen() to see if errors
+    /// Open the file; call isOpen() to see if errors.
+    /// A filename starting with "|" is instead a shell command that is
+    /// given the saved data on its standard input, for example
+    /// "| gzip -1 > saved.vltsv.gz" to compress as the data is written.
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
     void open(const std::string& filename) VL_MT_UNSAFE_ONE { open(filename.c_str()); }
+    /// Fork a copy-on-write child process, and open the file (as with
+    /// open()) only in that child.  In the child isOpen() is true, the
+    /// caller writes the model as usual, and close() or destruction exits
+    /// the child.  In the parent isOpen() is false, and simulation may
+    /// continue while the child writes.  If the fork fails, the file is
+    /// opened in this process, so the save completes before close()
+    /// returns.  Call only between evaluations, as with open().
+    void openForked(const char* filenamep) VL_MT_UNSAFE_ONE;
+    /// Fork a copy-on-write child process; see openForked(const char*)
+    void openForked(const std::string& filename) VL_MT_UNSAFE_ONE {
+        openForked(filename.c_str());
+    }
+    /// Wait for all openForked() child processes to finish.  Return false
+    /// if any child failed to write its file.
+    static bool waitForked() VL_MT_UNSAFE_ONE;
     /// Flush and close the file
     void close() override VL_MT_UNSAFE_ONE { closeImp(); }
     /// Flush data to file
@@ -223,6 +253,7 @@ public:
 class VerilatedRestore final : public VerilatedDeserialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    VlSavePid m_pid = 0;  // Pipe command process id, or zero if reading a file
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE {}
@@ -235,7 +266,9 @@ public:
     ~VerilatedRestore() override { closeImp(); }
 
     // METHODS
-    /// Open the file; call isOpen() to see if errors
+    /// Open the file; call isOpen() to see if errors.
+    /// A filename starting with "|" is instead a shell command whose
+    /// standard output is read, for example "| gzip -dc saved.vltsv.gz".
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
     void open(const std::string& filename) VL_MT_UNSAFE_ONE { open(filename.c_str()); }
@@ -245,6 +278,74 @@ public:
     void fill() override VL_MT_UNSAFE_ONE;
 };
 
+//=============================================================================
+// VerilatedSaveMem
+/// Stream-like object that serializes Verilated model to a memory buffer.
+///
+/// Together with VerilatedRestoreMem this snapshots a model in-process, so
+/// it may be rewound to the same point many times without file I/O.
+///
+/// This class is not thread safe, it must be called by a single thread
+
+class VerilatedSaveMem final : public VerilatedSerialize {
+private:
+    std::vector<uint8_t> m_data;  // Serialized data written so far
+
+    void closeImp() VL_MT_UNSAFE_ONE;
+    void flushImp() VL_MT_UNSAFE_ONE;
+
+public:
+    // CONSTRUCTORS
+    /// Construct new object
+    VerilatedSaveMem() = default;
+    /// Flush, close and destruct
+    ~VerilatedSaveMem() override { closeImp(); }
+    // METHODS
+    /// Discard any previous snapshot and start a new one
+    void open() VL_MT_UNSAFE_ONE;
+    /// Flush and close the snapshot, after which data() is complete
+    void close() override VL_MT_UNSAFE_ONE { closeImp(); }
+    /// Flush data to the snapshot
+    void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
+    /// Return the snapshot data
+    const std::vector<uint8_t>& data() const { return m_data; }
+};
+
+//=============================================================================
+// VerilatedRestoreMem
+/// Stream-like object that serializes Verilated model from a memory buffer
+/// made by VerilatedSaveMem.
+///
+/// This class is not thread safe, it must be called by a single thread
+
+class VerilatedRestoreMem final : public VerilatedDeserialize {
+private:
+    const uint8_t* m_datap = nullptr;  // Next snapshot byte to fill() from
+    const uint8_t* m_dataEndp = nullptr;  // End of snapshot data
+
+    void closeImp() VL_MT_UNSAFE_ONE;
+    void flushImp() VL_MT_UNSAFE_ONE {}
+
+public:
+    // CONSTRUCTORS
+    /// Construct new object
+    VerilatedRestoreMem() = default;
+    /// Close and destruct
+    ~VerilatedRestoreMem() override { closeImp(); }
+
+    // METHODS
+    /// Open snapshot data, which must not change until close()
+    void open(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE;
+    /// Open the snapshot in a closed VerilatedSaveMem
+    void open(const VerilatedSaveMem& snapshot) VL_MT_UNSAFE_ONE {
+        open(snapshot.data().data(), snapshot.data().size());
+    }
+    /// Close the snapshot
+    void close() override VL_MT_UNSAFE_ONE { closeImp(); }
+    void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
+    void fill() override VL_MT_UNSAFE_ONE;
+};
+
 //=============================================================================
 
 inline VerilatedSerialize& operator<<(VerilatedSerialize& os, const uint64_t& rhs) {
@@ -46,6 +46,34 @@ struct VerilatedCStrCmp final {
     bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
 };
 
+// Classes to hash unordered maps keyed by const char*'s
+struct VerilatedCStrHash final {
+    size_t operator()(const char* a) const {
+        // Hierarchical names are long, so mix a word at a time
+        const size_t len = std::strlen(a);
+        uint64_t hash = len * 0x9e3779b97f4a7c15ULL;
+        uint64_t word;
+        size_t i = 0;
+        for (; i + sizeof(word) <= len; i += sizeof(word)) {
+            std::memcpy(&word, a + i, sizeof(word));
+            hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+            hash ^= hash >> 32;
+        }
+        word = 0;
+        std::memcpy(&word, a + i, len - i);
+        hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+};
+struct VerilatedCStrEq final {
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) == 0; }
+};
+
+// Hashed index of names, for lookups not needing the sorted order of the maps below
+template <typename T_Value>
+using VerilatedCStrIndex
+    = std::unordered_map<const char*, T_Value, VerilatedCStrHash, VerilatedCStrEq>;
+
 // Map of sorted scope names to find associated scope class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
 class VerilatedScopeNameMap final
@@ -58,9 +86,27 @@ public:
 // Map of sorted variable names to find associated variable class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
 class VerilatedVarNameMap final : public std::map<const char*, VerilatedVar, VerilatedCStrCmp> {
+    VerilatedCStrIndex<VerilatedVar*> m_index;  // Hashed index of this map's variables
+
 public:
     VerilatedVarNameMap() = default;
     ~VerilatedVarNameMap() = default;
+    VL_UNCOPYABLE(VerilatedVarNameMap);  // m_index points into this map
+    // Insert unless already present, return the variable with that name
+    VerilatedVar* insertIndexed(const char* namep, VerilatedVar&& var) {
+        const auto pair = emplace(namep, std::move(var));
+        if (pair.second) m_index.emplace(pair.first->first, &pair.first->second);
+        return &pair.first->second;
+    }
+    // Find by name, return nullptr if not found
+    VerilatedVar* findIndexed(const char* namep) {
+        if (VL_UNLIKELY(m_index.size() != size())) {  // Inserted without index, be correct
+            const auto it = find(namep);
+            return it == end() ? nullptr : &it->second;
+        }
+        const auto it = m_index.find(namep);
+        return it == m_index.end() ? nullptr : it->second;
+    }
 };
 
 // Map of parent scope to vector of children scopes
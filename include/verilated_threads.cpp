@@ -51,12 +51,23 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
     assert(atomic_is_lock_free(&m_upstreamDepsDone));
 }
 
+//=============================================================================
+// VlMTaskReadyQueue
+
+VlMTaskReadyQueue::VlMTaskReadyQueue(uint32_t size)
+    : m_size{size}
+    , m_slotsp{new std::atomic<VlExecFnp>[size]} {
+    for (uint32_t i = 0; i < m_size; ++i) m_slotsp[i].store(nullptr, std::memory_order_relaxed);
+}
+
+VlMTaskReadyQueue::~VlMTaskReadyQueue() { delete[] m_slotsp; }
+
 //=============================================================================
 // VlWorkerThread
 
-VlWorkerThread::VlWorkerThread(VerilatedContext* contextp)
-    : m_ready_size{0}
-    , m_contextp{contextp} {
+VlWorkerThread::VlWorkerThread(VerilatedContext* contextp, uint32_t coverageShard)
+    : m_contextp{contextp}
+    , m_coverageShard{coverageShard} {
 #ifdef VL_USE_PTHREADS
     // Init attributes
     pthread_attr_t attr;
@@ -112,6 +123,7 @@ void VlWorkerThread::wait() {
 void VlWorkerThread::main() {
     // Initialize thread_locals
     Verilated::threadContextp(m_contextp);
+    Verilated::coverageShard(m_coverageShard);
     // One work item
     ExecRec work;
     // Wait for the first task without spinning, in case the thread is never actually used.
@@ -134,7 +146,8 @@ void* VlWorkerThread::start(void* argp) {
 
 VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads) {
     for (unsigned i = 0; i < nThreads; ++i) {
-        m_workers.push_back(new VlWorkerThread{contextp});
+        // Shard 0 is left to the thread calling eval
+        m_workers.push_back(new VlWorkerThread{contextp, i + 1});
         m_unassignedWorkers.push(i);
     }
     m_numaStatus = numaAssign(contextp);
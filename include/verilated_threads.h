@@ -124,6 +124,136 @@ public:
     }
 };
 
+// Ready list for dynamically scheduled mtasks (--threads-schedule dynamic).
+//
+// Every mtask becomes ready exactly once per evaluation, so ready mtasks are
+// appended to a fixed size array, and all threads executing the graph claim
+// the next entry in order until every mtask has been claimed. A thread that
+// claims an entry not yet published waits for it; this cannot deadlock, as
+// the claimed entries always include every ready, unfinished mtask.
+class VlMTaskReadyQueue final {
+    // MEMBERS
+    const uint32_t m_size;  // Number of mtasks in the graph
+    std::atomic<VlExecFnp>* const m_slotsp;  // Ready mtasks in order of readiness
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<uint32_t> m_head{0};  // Next entry to claim
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<uint32_t> m_tail{0};  // Next entry to publish
+
+    VL_UNCOPYABLE(VlMTaskReadyQueue);
+
+public:
+    // CONSTRUCTORS
+    explicit VlMTaskReadyQueue(uint32_t size);
+    ~VlMTaskReadyQueue();
+
+    // METHODS
+    // Called before the graph is started, when no other thread is using the queue
+    void reset() {
+        m_head.store(0, std::memory_order_relaxed);
+        m_tail.store(0, std::memory_order_relaxed);
+    }
+    // Mark an mtask whose upstream dependencies are all done as ready
+    void push(VlExecFnp fnp) {
+        // Acquire the results of all upstream mtasks (see signalUpstreamDone), so that
+        // the release below publishes them to the thread executing this mtask
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint32_t index = m_tail.fetch_add(1, std::memory_order_relaxed);
+        assert(index < m_size);
+        m_slotsp[index].store(fnp, std::memory_order_release);
+    }
+    // Execute ready mtasks until all have been claimed
+    void run(VlSelfP selfp, bool evenCycle) {
+        while (true) {
+            const uint32_t index = m_head.fetch_add(1, std::memory_order_relaxed);
+            if (index >= m_size) return;
+            std::atomic<VlExecFnp>& slot = m_slotsp[index];
+            VlExecFnp fnp = slot.load(std::memory_order_acquire);
+            unsigned ct = 0;
+            while (VL_UNLIKELY(!fnp)) {
+                VL_CPU_RELAX();
+                if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+                    ct = 0;
+                    VlMTaskVertex::yieldThread();
+                }
+                fnp = slot.load(std::memory_order_acquire);
+            }
+            // Only this thread claimed this entry, clear it for the next evaluation
+            slot.store(nullptr, std::memory_order_relaxed);
+            fnp(selfp, evenCycle);
+        }
+    }
+};
+
+// Bounded multiple-producer, single-consumer lock-free queue.
+//
+// Each slot carries a sequence number telling whether it is free for the
+// producer claiming that position, or holds an element for the consumer.
+// Producers claim a position with a CAS on m_tail, so several threads may
+// push concurrently; only one thread may pop.
+template <typename T_Elem, size_t N_Capacity>
+class VlMpscQueue final {
+    static_assert(N_Capacity && (N_Capacity & (N_Capacity - 1)) == 0,
+                  "VlMpscQueue capacity must be a power of 2");
+    static constexpr size_t MASK = N_Capacity - 1;
+
+    // TYPES
+    struct Slot final {
+        std::atomic<size_t> m_seq{0};  // Position this slot is next ready for
+        T_Elem m_elem;  // Element, valid when m_seq == position + 1
+    };
+
+    // MEMBERS
+    // Consumer side
+    alignas(VL_CACHE_LINE_BYTES) size_t m_head = 0;  // Next position to pop
+    // Producer side
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<size_t> m_tail{0};  // Next position to claim
+    // Element storage
+    alignas(VL_CACHE_LINE_BYTES) Slot m_slots[N_Capacity];
+
+    VL_UNCOPYABLE(VlMpscQueue);
+
+public:
+    // CONSTRUCTORS
+    VlMpscQueue() {
+        for (size_t i = 0; i < N_Capacity; ++i) {
+            m_slots[i].m_seq.store(i, std::memory_order_relaxed);
+        }
+    }
+    ~VlMpscQueue() = default;
+
+    // METHODS
+    // Any thread. Returns false if the queue is full.
+    bool tryPush(const T_Elem& elem) {
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        Slot* slotp;
+        while (true) {
+            slotp = &m_slots[pos & MASK];
+            const size_t seq = slotp->m_seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                // Slot free for this position, try to claim it
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                // On failure 'pos' was reloaded, retry with it
+            } else if (diff < 0) {
+                return false;  // Not yet popped since the previous lap, full
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);  // Claimed by another producer
+            }
+        }
+        slotp->m_elem = elem;
+        slotp->m_seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+    // Consumer only. Returns false if the queue is empty.
+    bool tryPop(T_Elem& elem) {
+        Slot& slot = m_slots[m_head & MASK];
+        if (slot.m_seq.load(std::memory_order_acquire) != m_head + 1) return false;
+        elem = slot.m_elem;
+        slot.m_seq.store(m_head + N_Capacity, std::memory_order_release);
+        ++m_head;
+        return true;
+    }
+};
+
 class VlWorkerThread final {
     friend class VlThreadPool;
 
@@ -140,19 +270,20 @@ class VlWorkerThread final {
     };
 
     // MEMBERS
+    // Pending tasks. Several threads may add tasks to the same worker, e.g.
+    // the eval thread and trace or profiler threads, or wait()/shutdown().
+    // Typically holds 0, 1 or 2 entries; addTask spins if it ever fills up.
+    VlMpscQueue<ExecRec, 256> m_ready;
+    // The mutex and condition variable are only used to put an idle worker
+    // to sleep, never on the hand-off fast path.
     mutable VerilatedMutex m_mutex;
     std::condition_variable_any m_cv;
     // Only notify the condition_variable if the worker is waiting
-    bool m_waiting VL_GUARDED_BY(m_mutex) = false;
-
-    // Why a vector? We expect the pending list to be very short, typically
-    // 0 or 1 or 2, so popping from the front shouldn't be
-    // expensive. Revisit if we ever have longer queues...
-    std::vector<ExecRec> m_ready VL_GUARDED_BY(m_mutex);
-    // Store the size atomically, so we can spin wait
-    std::atomic<size_t> m_ready_size;
+    std::atomic<bool> m_waiting{false};
     // Thread context
     VerilatedContext* const m_contextp;
+    // Coverage counter shard of this thread, see VL_COV_SHARD
+    const uint32_t m_coverageShard;
     // Underlying thread record
 #ifdef VL_USE_PTHREADS
     pthread_t m_pthread{};
@@ -168,7 +299,7 @@ class VlWorkerThread final {
 
 public:
     // CONSTRUCTORS
-    explicit VlWorkerThread(VerilatedContext* contextp);
+    VlWorkerThread(VerilatedContext* contextp, uint32_t coverageShard);
     ~VlWorkerThread();
 
     // METHODS
@@ -177,32 +308,35 @@ public:
         // Spin for a while, waiting for new data
         if VL_CONSTEXPR_CXX17 (N_SpinWait) {
             for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-                if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
+                if (VL_LIKELY(m_ready.tryPop(*workp))) return;
                 VL_CPU_RELAX();
             }
         }
+        if (m_ready.tryPop(*workp)) return;
+        // Nothing arrived, go to sleep. Holding the mutex from publishing
+        // m_waiting until m_cv.wait releases it ensures addTask cannot
+        // notify in between, so no wakeup is lost.
         const VerilatedLockGuard lock{m_mutex};
-        while (m_ready.empty()) {
-            m_waiting = true;
+        while (true) {
+            m_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with addTask
+            if (m_ready.tryPop(*workp)) break;
             m_cv.wait(m_mutex);
         }
-        m_waiting = false;
-        // As noted above this is inefficient if our ready list is ever
-        // long (but it shouldn't be)
-        *workp = m_ready.front();
-        m_ready.erase(m_ready.begin());
-        m_ready_size.fetch_sub(1, std::memory_order_relaxed);
+        m_waiting.store(false, std::memory_order_relaxed);
     }
     void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false)
         VL_MT_SAFE_EXCLUDES(m_mutex) {
-        bool notify;
-        {
-            const VerilatedLockGuard lock{m_mutex};
-            m_ready.emplace_back(fnp, selfp, evenCycle);
-            m_ready_size.fetch_add(1, std::memory_order_relaxed);
-            notify = m_waiting;
+        const ExecRec rec{fnp, selfp, evenCycle};
+        // If full, the worker drains the queue without further help from us
+        while (VL_UNLIKELY(!m_ready.tryPush(rec))) VlMTaskVertex::yieldThread();
+        std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with dequeWork
+        if (VL_UNLIKELY(m_waiting.load(std::memory_order_relaxed))) {
+            // Acquire the mutex so the worker is either not yet checking, or
+            // is already waiting on the condition variable
+            { const VerilatedLockGuard lock{m_mutex}; }
+            m_cv.notify_one();
         }
-        if (notify) m_cv.notify_one();
     }
 
     void shutdown();  // Finish current tasks, then terminate thread
@@ -23,6 +23,9 @@
 
 #include "verilated_timing.h"
 
+#include <algorithm>
+#include <functional>
+
 //======================================================================
 // VlCoroutineHandle:: Methods
 
@@ -54,6 +57,196 @@ void VlCoroutineHandle::dump() const {
 }
 #endif
 
+//======================================================================
+// VlCoroutineFramePool:: Methods
+
+thread_local VlCoroutineFramePool VlCoroutineFramePool::t_pool;
+thread_local bool VlCoroutineFramePool::t_destroyed = false;
+
+VlCoroutineFramePool::~VlCoroutineFramePool() {
+    t_destroyed = true;
+    for (FreeFrame* framep : m_freep) {
+        while (framep) {
+            FreeFrame* const nextp = framep->m_nextp;
+            ::operator delete(framep);
+            framep = nextp;
+        }
+    }
+}
+
+//======================================================================
+// VlDelayQueue:: Methods
+
+void VlDelayQueue::appendToSlot(int level, size_t slot, uint32_t idx) {
+    Slot& slotr = m_slots[level][slot];
+    m_nodes[idx].m_next = NONE;
+    if (slotr.m_tail == NONE) {
+        slotr.m_head = idx;
+        m_occupied[level][slot / 64] |= 1ULL << (slot % 64);
+    } else {
+        m_nodes[slotr.m_tail].m_next = idx;
+    }
+    slotr.m_tail = idx;
+}
+
+void VlDelayQueue::place(uint32_t idx) {
+    const Node& node = m_nodes[idx];
+    const uint64_t diff = node.m_time ^ m_base;
+    const int level = diff ? (VL_MOSTSETBITP1_Q(diff) - 1) / LEVEL_BITS : 0;
+    if (VL_UNLIKELY(level >= LEVELS)) {
+        m_heap.push_back(HeapEntry{node.m_time, node.m_seq, idx});
+        std::push_heap(m_heap.begin(), m_heap.end(), std::greater<HeapEntry>{});
+        return;
+    }
+    appendToSlot(level, (node.m_time >> (level * LEVEL_BITS)) & (SLOTS - 1), idx);
+}
+
+void VlDelayQueue::advance(uint64_t time) {
+    // All queued times are >= 'time', so only the slot of the highest level where the base
+    // changes may hold nodes that belong to a lower level now; levels below it are empty.
+    const uint64_t diff = time ^ m_base;
+    m_base = time;
+    const int level = (VL_MOSTSETBITP1_Q(diff) - 1) / LEVEL_BITS;
+    if (level == 0) return;
+    if (level < LEVELS) {
+        const size_t slot = (time >> (level * LEVEL_BITS)) & (SLOTS - 1);
+        Slot& slotr = m_slots[level][slot];
+        uint32_t idx = slotr.m_head;
+        slotr.m_head = slotr.m_tail = NONE;
+        m_occupied[level][slot / 64] &= ~(1ULL << (slot % 64));
+        while (idx != NONE) {
+            const uint32_t next = m_nodes[idx].m_next;
+            place(idx);
+            idx = next;
+        }
+        return;
+    }
+    // Moved past the span of the wheel, take earliest nodes from the heap
+    while (!m_heap.empty()
+           && (m_heap.front().m_time >> (LEVELS * LEVEL_BITS))
+                  == (time >> (LEVELS * LEVEL_BITS))) {
+        const uint32_t idx = m_heap.front().m_node;
+        std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<HeapEntry>{});
+        m_heap.pop_back();
+        place(idx);
+    }
+}
+
+void VlDelayQueue::rebuild(uint64_t base) {
+    // Rare: a time earlier than the base got queued. Re-place all nodes in order.
+    std::vector<HeapEntry> entries;
+    entries.reserve(m_size);
+    for (uint32_t i = 0; i < m_nodes.size(); ++i) {
+        if (m_nodes[i].m_seq != FREE_SEQ) {
+            entries.push_back(HeapEntry{m_nodes[i].m_time, m_nodes[i].m_seq, i});
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const HeapEntry& a, const HeapEntry& b) { return b > a; });
+    for (auto& level : m_slots) {
+        for (Slot& slotr : level) slotr = Slot{};
+    }
+    for (auto& level : m_occupied) {
+        for (uint64_t& word : level) word = 0;
+    }
+    m_heap.clear();
+    m_base = base;
+    for (const HeapEntry& entry : entries) place(entry.m_node);
+}
+
+uint64_t VlDelayQueue::computeFrontTime() const {
+    // Lower levels always hold earlier times than higher levels
+    for (int level = 0; level < LEVELS; ++level) {
+        const int slot = lowestSlot(level);
+        if (slot < 0) continue;
+        uint32_t idx = m_slots[level][slot].m_head;
+        // Level 0 slots hold a single time, otherwise need to search
+        uint64_t earliest = m_nodes[idx].m_time;
+        if (level) {
+            for (idx = m_nodes[idx].m_next; idx != NONE; idx = m_nodes[idx].m_next) {
+                earliest = std::min(earliest, m_nodes[idx].m_time);
+            }
+        }
+        return earliest;
+    }
+    if (!m_heap.empty()) return m_heap.front().m_time;
+    return std::numeric_limits<uint64_t>::max();
+}
+
+void VlDelayQueue::push(uint64_t time, VlCoroutineHandle&& handle) {
+    if (VL_UNLIKELY(time < m_base)) rebuild(time);
+    uint32_t idx;
+    if (m_freeHead != NONE) {
+        idx = m_freeHead;
+        Node& node = m_nodes[idx];
+        m_freeHead = node.m_next;
+        node.m_time = time;
+        node.m_seq = m_nextSeq++;
+        node.m_handle = std::move(handle);
+    } else {
+        idx = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back(time, m_nextSeq++, std::move(handle));
+    }
+    place(idx);
+    ++m_size;
+    if (m_frontValid && time < m_frontTime) m_frontTime = time;
+}
+
+VlCoroutineHandle VlDelayQueue::pop() {
+    const uint64_t time = frontTime();
+    if (time != m_base) advance(time);
+    // The earliest time equals the base, so it is in level 0
+    const size_t slot = time & (SLOTS - 1);
+    Slot& slotr = m_slots[0][slot];
+    const uint32_t idx = slotr.m_head;
+    Node& node = m_nodes[idx];
+    slotr.m_head = node.m_next;
+    if (slotr.m_head == NONE) {
+        slotr.m_tail = NONE;
+        m_occupied[0][slot / 64] &= ~(1ULL << (slot % 64));
+        m_frontValid = false;
+    }
+    VlCoroutineHandle handle{std::move(node.m_handle)};
+    node.m_seq = FREE_SEQ;
+    node.m_next = m_freeHead;
+    m_freeHead = idx;
+    --m_size;
+    return handle;
+}
+
+void VlDelayQueue::clear() {
+    // Destroying the nodes destroys the suspended coroutines
+    m_nodes.clear();
+    m_freeHead = NONE;
+    m_heap.clear();
+    for (auto& level : m_slots) {
+        for (Slot& slotr : level) slotr = Slot{};
+    }
+    for (auto& level : m_occupied) {
+        for (uint64_t& word : level) word = 0;
+    }
+    m_size = 0;
+    m_frontTime = std::numeric_limits<uint64_t>::max();
+    m_frontValid = true;
+}
+
+#ifdef VL_DEBUG
+void VlDelayQueue::dump() const {
+    std::vector<HeapEntry> entries;
+    for (uint32_t i = 0; i < m_nodes.size(); ++i) {
+        if (m_nodes[i].m_seq != FREE_SEQ) {
+            entries.push_back(HeapEntry{m_nodes[i].m_time, m_nodes[i].m_seq, i});
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const HeapEntry& a, const HeapEntry& b) { return b > a; });
+    for (const HeapEntry& entry : entries) {
+        VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", entry.m_time);
+        m_nodes[entry.m_node].m_handle.dump();
+    }
+}
+#endif
+
 //======================================================================
 // VlDelayScheduler:: Methods
 
@@ -69,9 +262,8 @@ void VlDelayScheduler::resume() {
     }
     bool resumed = false;
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
+    while (!m_queue.empty() && (m_queue.frontTime() == m_context.time())) {
+        VlCoroutineHandle handle = m_queue.pop();
         handle.resume();
         resumed = true;
     }
@@ -100,7 +292,7 @@ void VlDelayScheduler::resumeZeroDelay() {
 }
 
 uint64_t VlDelayScheduler::nextTimeSlot() const {
-    if (!m_queue.empty()) return m_queue.cbegin()->first;
+    if (!m_queue.empty()) return m_queue.frontTime();
     if (m_zeroDelayed.empty())
         VL_FATAL_MT(__FILE__, __LINE__, "", "There is no next time slot scheduled");
     return m_context.time();
@@ -118,10 +310,7 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
-        for (const auto& susp : m_queue) {
-            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
-            susp.second.dump();
-        }
+        m_queue.dump();
     }
 }
 #endif
@@ -158,18 +158,110 @@ public:
 
 enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 
+//=============================================================================
+// VlDelayQueue is the time-ordered queue of delayed coroutines used by VlDelayScheduler. It is a
+// hierarchical timing wheel: a coroutine awaiting time T is kept in the slot of the level given by
+// the most significant byte in which T differs from the wheel's base time. Inserting and resuming
+// near delays is O(1); slots of higher levels are cascaded down as the base time advances.
+// Delays beyond the span of the wheel are kept in a heap. Coroutines awaiting the same time are
+// resumed in the order they were added. List nodes are pooled to avoid allocating on every delay.
+
+class VlDelayQueue final {
+    // CONSTANTS
+    static constexpr int LEVEL_BITS = 8;  // Time bits per wheel level
+    static constexpr int LEVELS = 4;  // Wheel spans 2^32 time units, beyond that goes into heap
+    static constexpr size_t SLOTS = 1ULL << LEVEL_BITS;  // Slots per level
+    static constexpr size_t SLOT_WORDS = SLOTS / 64;  // Words in a level's occupancy bitmap
+    static constexpr uint32_t NONE = 0xffffffffU;  // Null node index
+    static constexpr uint64_t FREE_SEQ = ~0ULL;  // Insertion order of free nodes
+
+    // TYPES
+    struct Node final {
+        uint64_t m_time;  // Time to resume at
+        uint64_t m_seq;  // Insertion order, to keep order among equal times
+        uint32_t m_next = NONE;  // Next node in slot list or free list
+        VlCoroutineHandle m_handle;  // Coroutine to resume, null when node is free
+        Node(uint64_t time, uint64_t seq, VlCoroutineHandle&& handle)
+            : m_time{time}
+            , m_seq{seq}
+            , m_handle{std::move(handle)} {}
+    };
+    struct Slot final {
+        uint32_t m_head = NONE;  // First node in slot, resumed first
+        uint32_t m_tail = NONE;  // Last node in slot
+    };
+    struct HeapEntry final {
+        uint64_t m_time;  // Time to resume at
+        uint64_t m_seq;  // Insertion order
+        uint32_t m_node;  // Index of node
+        bool operator>(const HeapEntry& rhs) const {
+            return m_time != rhs.m_time ? m_time > rhs.m_time : m_seq > rhs.m_seq;
+        }
+    };
+
+    // MEMBERS
+    std::vector<Node> m_nodes;  // Node pool
+    uint32_t m_freeHead = NONE;  // Free list of nodes in m_nodes
+    uint64_t m_base = 0;  // Base time of the wheel, no earlier than any queued time
+    uint64_t m_nextSeq = 0;  // Next insertion order number
+    size_t m_size = 0;  // Number of queued coroutines
+    mutable uint64_t m_frontTime = std::numeric_limits<uint64_t>::max();  // Earliest time cache
+    mutable bool m_frontValid = true;  // m_frontTime is up to date
+    Slot m_slots[LEVELS][SLOTS];  // Wheel levels
+    uint64_t m_occupied[LEVELS][SLOT_WORDS] = {};  // Bitmap of non-empty slots per level
+    std::vector<HeapEntry> m_heap;  // Min-heap of coroutines beyond the wheel's span
+
+    // METHODS
+    // Lowest non-empty slot in level, or -1 if none
+    int lowestSlot(int level) const {
+        for (size_t w = 0; w < SLOT_WORDS; ++w) {
+            const uint64_t word = m_occupied[level][w];
+            if (word) return static_cast<int>(w * 64 + VL_MOSTSETBITP1_Q(word & (~word + 1)) - 1);
+        }
+        return -1;
+    }
+    void appendToSlot(int level, size_t slot, uint32_t idx);
+    void place(uint32_t idx);  // Put node in the wheel or heap based on m_base
+    void advance(uint64_t time);  // Move base to time, cascading slots as needed
+    void rebuild(uint64_t base);  // Re-place all nodes for an earlier base
+    uint64_t computeFrontTime() const;
+
+public:
+    // CONSTRUCTORS
+    VlDelayQueue() = default;
+    ~VlDelayQueue() = default;
+    VL_UNCOPYABLE(VlDelayQueue);
+
+    // METHODS
+    bool empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+    // Earliest time a coroutine awaits (must not be empty)
+    uint64_t frontTime() const {
+        if (VL_UNLIKELY(!m_frontValid)) {
+            m_frontTime = computeFrontTime();
+            m_frontValid = true;
+        }
+        return m_frontTime;
+    }
+    // Add coroutine to be resumed at the given time
+    void push(uint64_t time, VlCoroutineHandle&& handle);
+    // Remove and return the earliest coroutine (must not be empty)
+    VlCoroutineHandle pop();
+    // Remove all coroutines, destroying them
+    void clear();
+#ifdef VL_DEBUG
+    void dump() const;
+#endif
+};
+
 //=============================================================================
 // VlDelayScheduler stores coroutines to be resumed at a certain simulation time. If the current
 // time is equal to a coroutine's resume time, the coroutine gets resumed.
 
 class VlDelayScheduler final {
-    // TYPES
-    // Time-sorted queue of timestamps and handles
-    using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
-
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    VlDelayQueue m_queue;  // Coroutines to be restored at a certain simulation time
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     // Coroutines that waited for #0 and are being resumed now. As member to avoid reallocations
     std::vector<VlCoroutineHandle> m_zeroDelayesSwap;
@@ -191,7 +283,7 @@ public:
     // Are there coroutines to resume at the current simulation time?
     bool awaitingCurrentTime() const {
         return !m_context.gotFinish()
-               && (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()));
+               && (!m_queue.empty() && (m_queue.frontTime() <= m_context.time()));
     }
     // Are there coroutines to resume in the inactive region after a #0 delay?
     bool awaitingZeroDelay() const { return !m_context.gotFinish() && !m_zeroDelayed.empty(); }
@@ -203,7 +295,7 @@ public:
                int lineno = 0) {
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
+            VlDelayQueue& queue;
             std::vector<VlCoroutineHandle>& queueZeroDelay;
             const uint64_t delay;
             const VlDelayPhase phase;
@@ -213,7 +305,7 @@ public:
             void await_suspend(std::coroutine_handle<> coro) {
                 // Both active delays and fork..join_none #0 are resumed out of the time queue.
                 if (phase != VlDelayPhase::INACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    queue.push(delay, VlCoroutineHandle{coro, process, fileline});
                 } else {
                     queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
                 }
@@ -440,6 +532,70 @@ public:
     }
 };
 
+//=============================================================================
+// VlCoroutineFramePool allocates coroutine frames. Freed frames are kept in per-thread free lists
+// by size class and reused, as forked processes and short tasks create and destroy frames at a
+// high rate. Frames are plain heap blocks, so a frame may be freed by a different thread than the
+// one that allocated it. Allocations are counted in the statistics of the thread's context.
+
+class VlCoroutineFramePool final {
+    // CONSTANTS
+    static constexpr size_t GRANULE = 64;  // Size class granularity in bytes
+    static constexpr size_t CLASSES = 32;  // Number of size classes, larger frames are not pooled
+    static constexpr size_t MAX_FREE = 1024;  // Maximum free frames kept per size class
+
+    // TYPES
+    struct FreeFrame final {
+        FreeFrame* m_nextp;  // Next free frame of the same size class
+    };
+
+    // MEMBERS
+    FreeFrame* m_freep[CLASSES] = {};  // Free lists per size class
+    size_t m_freeCount[CLASSES] = {};  // Number of frames in each free list
+
+    static thread_local VlCoroutineFramePool t_pool;  // Pool of the current thread
+    static thread_local bool t_destroyed;  // t_pool got destroyed on thread exit
+
+    // CONSTRUCTORS
+    VlCoroutineFramePool() = default;
+    ~VlCoroutineFramePool();
+    VL_UNCOPYABLE(VlCoroutineFramePool);
+
+public:
+    // METHODS
+    static void* allocate(size_t size) {
+        const size_t sizeClass = (size - 1) / GRANULE;
+        if (VL_UNLIKELY(sizeClass >= CLASSES)) {
+            if (!t_destroyed) Verilated::threadContextp()->coroutineFrameAllocatedInc();
+            return ::operator new(size);
+        }
+        // Always allocate the full size class, so any thread's pool can reuse the frame
+        if (VL_UNLIKELY(t_destroyed)) return ::operator new((sizeClass + 1) * GRANULE);
+        VlCoroutineFramePool& pool = t_pool;
+        if (FreeFrame* const framep = pool.m_freep[sizeClass]) {
+            pool.m_freep[sizeClass] = framep->m_nextp;
+            --pool.m_freeCount[sizeClass];
+            Verilated::threadContextp()->coroutineFrameReusedInc();
+            return framep;
+        }
+        Verilated::threadContextp()->coroutineFrameAllocatedInc();
+        return ::operator new((sizeClass + 1) * GRANULE);
+    }
+    static void deallocate(void* ptr, size_t size) noexcept {
+        const size_t sizeClass = (size - 1) / GRANULE;
+        if (VL_UNLIKELY(sizeClass >= CLASSES || t_destroyed
+                        || t_pool.m_freeCount[sizeClass] >= MAX_FREE)) {
+            ::operator delete(ptr);
+            return;
+        }
+        VlCoroutineFramePool& pool = t_pool;
+        FreeFrame* const framep = static_cast<FreeFrame*>(ptr);
+        framep->m_nextp = pool.m_freep[sizeClass];
+        pool.m_freep[sizeClass] = framep;
+        ++pool.m_freeCount[sizeClass];
+    }
+};
+
 //=============================================================================
 // VlCoroutine
 // Return value of a coroutine. Used for chaining coroutine suspension/resumption.
@@ -455,6 +611,12 @@ private:
 
         VlCoroutine get_return_object() { return {this}; }
 
+        // Allocate coroutine frames from the per-thread frame pool
+        static void* operator new(size_t size) { return VlCoroutineFramePool::allocate(size); }
+        static void operator delete(void* ptr, size_t size) noexcept {
+            VlCoroutineFramePool::deallocate(ptr, size);
+        }
+
         // Never suspend at the start of the coroutine
         std::suspend_never initial_suspend() const { return {}; }
 
@@ -521,17 +521,30 @@ class VlReadMem final {
     const int m_bits;  // Bit width of values
     const std::string& m_filename;  // Filename
     const QData m_end;  // End address (as specified by user)
-    FILE* m_fp = nullptr;  // File handle for filename
+    const char* m_datap = nullptr;  // File contents
+    size_t m_size = 0;  // Size of file contents
+    size_t m_pos = 0;  // Offset of next character to read
+    std::string m_text;  // File contents when not memory mapped
+    bool m_isOpen = false;  // File was opened
+    bool m_mapped = false;  // m_datap is memory mapped, else points to m_text
     QData m_addr = 0;  // Next address to read
     int m_linenum = 0;  // Line number last read from file
     bool m_anyAddr = false;  // Had address directive in the file
 public:
     VlReadMem(bool hex, int bits, const std::string& filename, QData start, QData end);
     ~VlReadMem();
-    bool isOpen() const { return m_fp != nullptr; }
+    VL_UNCOPYABLE(VlReadMem);
+    bool isOpen() const { return m_isOpen; }
     int linenum() const { return m_linenum; }
     bool get(QData& addrr, std::string& valuer);
     void setData(void* valuep, const std::string& rhs);
+    // Load the whole file into an unpacked array of depth rows starting at array_lsb
+    void load(QData depth, int array_lsb, void* memp);
+
+private:
+    void endCheck();
+    void loadImage(QData depth, int array_lsb, void* memp);
+    void loadText(QData depth, int array_lsb, void* memp);
 };
 
 class VlWriteMem final {
@@ -206,6 +206,7 @@ void VerilatedVcd::emitTimeChange(uint64_t timeui) {
 
 VerilatedVcd::~VerilatedVcd() {
     close();
+    writerStop();
     if (m_wrBufp) VL_DO_CLEAR(delete[] m_wrBufp, m_wrBufp = nullptr);
     if (m_filep && m_fileNewed) VL_DO_CLEAR(delete m_filep, m_filep = nullptr);
     if (parallel()) {
@@ -220,6 +221,7 @@ void VerilatedVcd::closePrev() {
 
     Super::flushBase();
     bufferFlush();
+    writerDrain();
     m_isOpen = false;
     m_filep->close();
 }
@@ -232,6 +234,7 @@ void VerilatedVcd::closeErr() {
 
     // No buffer flush, just fclose
     m_isOpen = false;
+    writerDrain();  // Discards data pending after the error
     m_filep->close();  // May get error, just ignore it
 }
 
@@ -249,6 +252,14 @@ void VerilatedVcd::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     Super::flushBase();
     bufferFlush();
+    writerDrain();
+}
+
+void VerilatedVcd::parallelFlush(unsigned maxPendingBuffers) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    m_parallelFlush = maxPendingBuffers;
+    // Pending buffers must reach the file before any written inline
+    if (!m_parallelFlush) writerDrain();
 }
 
 void VerilatedVcd::printStr(const char* str) {
@@ -277,32 +288,41 @@ void VerilatedVcd::bufferResize(size_t minsize) {
     }
 }
 
+bool VerilatedVcd::bufferWrite(const char* bufp, size_t size) VL_MT_UNSAFE_ONE {
+    // Write all of the given data to the file, return false with errno set on error
+    const char* wp = bufp;
+    const char* const endp = bufp + size;
+    while (wp < endp) {
+        errno = 0;
+        const ssize_t got = m_filep->write(wp, endp - wp);
+        if (got > 0) {
+            wp += got;
+        } else if (VL_UNCOVERABLE(got < 0)) {
+            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) return false;
+        }
+    }
+    return true;
+}
+
 void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
     // This function is on the flush() call path
     // We add output data to m_writep.
     // When it gets nearly full we dump it using this routine which calls write()
     // This is much faster than using buffered I/O
     if (VL_UNLIKELY(!m_isOpen)) return;
-    const char* wp = m_wrBufp;
-    while (true) {
-        const ssize_t remaining = (m_writep - wp);
-        if (remaining == 0) break;
-        errno = 0;
-        const ssize_t got = m_filep->write(wp, remaining);
-        if (got > 0) {
-            wp += got;
-            m_wroteBytes += got;
-        } else if (VL_UNCOVERABLE(got < 0)) {
-            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
-                // LCOV_EXCL_START
-                // write failed, presume error (perhaps out of disk space)
-                const std::string msg = "VerilatedVcd::bufferFlush: "s + std::strerror(errno);
-                VL_FATAL_MT("", 0, "", msg.c_str());
-                closeErr();
-                break;
-                // LCOV_EXCL_STOP
-            }
+    if (m_parallelFlush) {
+        bufferHandoff();
+    } else {
+        const size_t size = m_writep - m_wrBufp;
+        if (VL_UNCOVERABLE(!bufferWrite(m_wrBufp, size))) {
+            // LCOV_EXCL_START
+            // write failed, presume error (perhaps out of disk space)
+            const std::string msg = "VerilatedVcd::bufferFlush: "s + std::strerror(errno);
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            closeErr();
+            // LCOV_EXCL_STOP
         }
+        m_wroteBytes += size;
     }
 
     // Reset buffer
@@ -311,6 +331,102 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
     m_wrTimeEndp = nullptr;
 }
 
+void VerilatedVcd::bufferHandoff() VL_MT_UNSAFE_ONE {
+    // Queue the output buffer for the writer thread, and continue in a spare buffer
+    if (VL_UNLIKELY(!m_writerThread.joinable())) {
+        m_writerThread = std::thread{[this] { writerThread(); }};
+    }
+    const size_t size = m_wrChunkSize * 8;
+    const size_t used = m_writep - m_wrBufp;
+    WriteBuffer spare{nullptr, 0, 0};
+    int err;
+    {
+        const VerilatedLockGuard lock{m_writerMutex};
+        // Bound memory use by stalling until a pending buffer is written
+        while (m_writerPending.size() >= m_parallelFlush) m_writerCv.wait(m_writerMutex);
+        m_writerPending.push_back({m_wrBufp, size, used});
+        if (!m_writerFree.empty()) {
+            spare = m_writerFree.back();
+            m_writerFree.pop_back();
+        }
+        err = m_writerErrno;
+    }
+    m_writerCv.notify_all();
+    m_wroteBytes += used;
+    // Buffers written before a bufferResize are too small, replace them
+    if (spare.m_size != size) {
+        if (spare.m_bufp) VL_DO_CLEAR(delete[] spare.m_bufp, spare.m_bufp = nullptr);
+        spare.m_bufp = new char[size];
+    }
+    m_wrBufp = spare.m_bufp;
+    m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
+    if (VL_UNCOVERABLE(err)) {
+        // LCOV_EXCL_START
+        const std::string msg = "VerilatedVcd::bufferFlush: "s + std::strerror(err);
+        VL_FATAL_MT("", 0, "", msg.c_str());
+        closeErr();
+        // LCOV_EXCL_STOP
+    }
+}
+
+void VerilatedVcd::writerDrain() VL_MT_UNSAFE_ONE {
+    // Wait until the writer thread has written all pending output buffers
+    if (!m_writerThread.joinable()) return;
+    int err;
+    {
+        const VerilatedLockGuard lock{m_writerMutex};
+        while (!m_writerPending.empty()) m_writerCv.wait(m_writerMutex);
+        err = m_writerErrno;
+        m_writerErrno = 0;
+    }
+    if (VL_UNCOVERABLE(err && m_isOpen)) {
+        // LCOV_EXCL_START
+        const std::string msg = "VerilatedVcd::bufferFlush: "s + std::strerror(err);
+        VL_FATAL_MT("", 0, "", msg.c_str());
+        closeErr();
+        // LCOV_EXCL_STOP
+    }
+}
+
+void VerilatedVcd::writerStop() VL_MT_UNSAFE_ONE {
+    // Shut down the writer thread, after it has written all pending output buffers
+    if (m_writerThread.joinable()) {
+        {
+            const VerilatedLockGuard lock{m_writerMutex};
+            m_writerShutdown = true;
+        }
+        m_writerCv.notify_all();
+        m_writerThread.join();
+    }
+    const VerilatedLockGuard lock{m_writerMutex};
+    for (WriteBuffer& buf : m_writerFree) VL_DO_CLEAR(delete[] buf.m_bufp, buf.m_bufp = nullptr);
+    m_writerFree.clear();
+}
+
+void VerilatedVcd::writerThread() {
+    while (true) {
+        WriteBuffer buf{nullptr, 0, 0};
+        bool failed;
+        {
+            const VerilatedLockGuard lock{m_writerMutex};
+            while (!m_writerShutdown && m_writerPending.empty()) m_writerCv.wait(m_writerMutex);
+            if (m_writerPending.empty()) return;  // Shut down, and nothing left to write
+            buf = m_writerPending.front();
+            failed = m_writerErrno != 0;
+        }
+        // Write without holding the lock, so the simulation can queue the next buffer.
+        // After an error, discard the remaining data, closeErr() is on its way.
+        const int err = (failed || bufferWrite(buf.m_bufp, buf.m_used)) ? 0 : errno;
+        {
+            const VerilatedLockGuard lock{m_writerMutex};
+            if (VL_UNCOVERABLE(err && !m_writerErrno)) m_writerErrno = err;
+            m_writerPending.pop_front();
+            m_writerFree.push_back(buf);
+        }
+        m_writerCv.notify_all();
+    }
+}
+
 //=============================================================================
 // Definitions
 
@@ -608,6 +724,7 @@ void VerilatedVcdBuffer::finishLine(uint32_t code, char* writep) {
             m_owner.m_writep = m_writep;
             m_owner.bufferFlush();
             m_writep = m_owner.m_writep;
+            m_wrFlushp = m_owner.m_wrFlushp;  // May have switched output buffer
         }
     }
 }
@@ -24,7 +24,9 @@
 #include "verilated.h"
 #include "verilated_trace.h"
 
+#include <deque>
 #include <string>
+#include <thread>
 #include <vector>
 
 class VerilatedVcdBuffer;
@@ -71,8 +73,28 @@ private:
     std::vector<std::pair<char*, size_t>> m_freeBuffers;
     size_t m_numBuffers = 0;  // Number of trace buffers allocated
 
+    // Background file writing (see parallelFlush)
+    struct WriteBuffer final {
+        char* m_bufp;  // Output buffer
+        size_t m_size;  // Allocated size of m_bufp
+        size_t m_used;  // Number of bytes to write from m_bufp
+    };
+    unsigned m_parallelFlush = 0;  // Maximum output buffers pending write, 0 = write inline
+    std::thread m_writerThread;  // Thread writing pending output buffers
+    mutable VerilatedMutex m_writerMutex;  // Guards writer thread state
+    std::condition_variable_any m_writerCv;  // Signals pending, written, or shutdown
+    std::deque<WriteBuffer> m_writerPending VL_GUARDED_BY(m_writerMutex);  // Oldest first
+    std::vector<WriteBuffer> m_writerFree VL_GUARDED_BY(m_writerMutex);  // Written buffers
+    bool m_writerShutdown VL_GUARDED_BY(m_writerMutex) = false;  // Writer thread to exit
+    int m_writerErrno VL_GUARDED_BY(m_writerMutex) = 0;  // First write error, 0 = none
+
     void bufferResize(size_t minsize);
     void bufferFlush() VL_MT_UNSAFE_ONE;
+    bool bufferWrite(const char* bufp, size_t size) VL_MT_UNSAFE_ONE;
+    void bufferHandoff() VL_MT_UNSAFE_ONE;
+    void writerDrain() VL_MT_UNSAFE_ONE;
+    void writerStop() VL_MT_UNSAFE_ONE;
+    void writerThread();
     void bufferCheck() {
         // Flush the write buffer if there's not enough space left for new information
         // We only call this once per vector, so we need enough slop for a very wide "b###" line
@@ -118,6 +140,8 @@ public:
     // ACCESSORS
     // Set size in bytes after which new file should be created.
     void rolloverSize(uint64_t size) VL_MT_SAFE { m_rolloverSize = size; }
+    // Set maximum number of output buffers written by a background thread, 0 = write inline
+    void parallelFlush(unsigned maxPendingBuffers) VL_MT_SAFE_EXCLUDES(m_mutex);
 
     // METHODS - All must be thread safe
     // Open the file; call isOpen() to see if errors
@@ -217,7 +241,7 @@ class VerilatedVcdBuffer VL_NOT_FINAL {
     // Write pointer into output buffer (in parallel mode, this is set up in 'getTraceBuffer')
     char* m_writep = m_owner.parallel() ? nullptr : m_owner.m_writep;
     // Output buffer flush trigger location (only used when not parallel)
-    char* const m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
+    char* m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
 
     // VCD line end string codes + metadata
     const char* const m_suffixes = m_owner.m_suffixes.data();
@@ -313,6 +337,13 @@ public:
     /// alignment to a start of a given time's dump).  Any file but the
     /// first may be removed.  Cat files together to create viewable vcd.
     void rolloverSize(size_t size) VL_MT_SAFE { m_sptrace.rolloverSize(size); }
+    /// Set the maximum number of full output buffers being written by a
+    /// background thread while the simulation continues (default 0, which
+    /// writes on the simulation thread). A VerilatedVcdFile passed to the
+    /// constructor must then allow write() to be called from that thread.
+    void parallelFlush(unsigned maxPendingBuffers) VL_MT_SAFE {
+        m_sptrace.parallelFlush(maxPendingBuffers);
+    }
     /// Close dump
     void close() VL_MT_SAFE {
         m_sptrace.close();
@@ -41,7 +41,6 @@
 #include <cstring>
 #include <list>
 #include <map>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -1051,6 +1050,12 @@ class VerilatedVpiImp final {
     enum { CB_ENUM_MAX_VALUE = cbAtEndOfSimTime + 1 };  // Maximum callback reason
     using VpioCbList = std::list<VerilatedVpiCbHolder>;
     using VpioFutureCbs = std::map<std::pair<QData, uint64_t>, VerilatedVpiCbHolder>;
+    struct VpioValueWatch final {  // cbValueChange callback, flattened for change scanning
+        VpioCbList::iterator m_it;  // Callback in m_cbCurrentLists[cbValueChange]
+        const void* m_datap;  // Current value, varDatap() of the callback's object
+        const void* m_prevDatap;  // Previous value, prevDatap() of the callback's object
+        uint32_t m_size;  // Bytes to compare, entSize() of the callback's object
+    };
 
     // All only medium-speed, so use singleton function
     // Callbacks that are past or at current timestamp
@@ -1058,6 +1063,9 @@ class VerilatedVpiImp final {
     VpioCbList m_cbCallList;  // List of callbacks currently being called by callCbs
     VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
     VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
+    std::vector<VpioValueWatch> m_valueWatches;  // cbValueChange callbacks, in registration order
+    bool m_valueWatchesRemoved = false;  // A cbValueChange was removed, needs cleanup
+    std::vector<const VerilatedVpioVar*> m_valueUpdates;  // callValueCbs objects to updatePrev
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
@@ -1082,7 +1090,14 @@ public:
                                     cb_data_p->reason, id, cb_data_p->obj););
         VerilatedVpioVar* varop = nullptr;
         if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
-        s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
+        VpioCbList& cbObjList = s().m_cbCurrentLists[cb_data_p->reason];
+        cbObjList.emplace_back(id, cb_data_p, varop);
+        if (varop) {
+            const VerilatedVpioVar* const holderVarop
+                = VerilatedVpioVar::castp(cbObjList.back().cb_datap()->obj);
+            s().m_valueWatches.push_back({std::prev(cbObjList.end()), holderVarop->varDatap(),
+                                          holderVarop->prevDatap(), holderVarop->entSize()});
+        }
     }
     static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
@@ -1108,6 +1123,7 @@ public:
         for (auto& ir : s().m_cbCurrentLists[reason]) {
             if (ir.id() == id) {
                 ir.invalidate();
+                if (reason == cbValueChange) s().m_valueWatchesRemoved = true;
                 return;  // Once found, it won't also be in m_cbCallList, m_futureCbs, or m_nextCbs
             }
         }
@@ -1175,6 +1191,7 @@ public:
         if (s().m_cbCurrentLists[reason].empty()) return false;
         // Iterate on old list, making new list empty, to prevent looping over newly added elements
         std::swap(s().m_cbCurrentLists[reason], s().m_cbCallList);
+        if (VL_UNLIKELY(reason == cbValueChange)) s().m_valueWatches.clear();  // All now called
         bool called = false;
         for (VerilatedVpiCbHolder& ihor : s().m_cbCallList) {
             // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
@@ -1257,32 +1274,44 @@ public:
     }
     static bool callValueCbs() VL_MT_UNSAFE_ONE {
         assertOneCheck();
-        VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
-        bool called = false;
-        std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
-        if (cbObjList.empty()) return called;
-        const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
-        for (auto it = cbObjList.begin(); true;) {
-            // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
-            const bool was_last = it == last;
-            if (VL_UNLIKELY(it->invalid())) {  // Deleted earlier, cleanup
-                it = cbObjList.erase(it);
-                if (was_last) break;
-                continue;
+        std::vector<VpioValueWatch>& watches = s().m_valueWatches;
+        if (s().m_valueWatchesRemoved) {  // Cleanup callbacks deleted earlier
+            s().m_valueWatchesRemoved = false;
+            VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
+            size_t keep = 0;
+            for (const VpioValueWatch& watch : watches) {
+                if (watch.m_it->invalid()) {
+                    cbObjList.erase(watch.m_it);
+                } else {
+                    watches[keep++] = watch;
+                }
             }
-            VerilatedVpiCbHolder& ho = *it++;
+            watches.resize(keep);
+        }
+        std::vector<const VerilatedVpioVar*>& update = s().m_valueUpdates;
+        update.clear();
+        bool called = false;
+        // Only the flat watch entries are touched for the common case of an
+        // unchanged value; identical raw bytes mean valueDiffersFromPrev is false.
+        // Index, as callbacks may add watches; those are not called until next time.
+        const size_t nWatches = watches.size();
+        for (size_t i = 0; i < nWatches; ++i) {
+            const VpioValueWatch& watch = watches[i];
+            if (VL_LIKELY(!std::memcmp(watch.m_prevDatap, watch.m_datap, watch.m_size))) continue;
+            VerilatedVpiCbHolder& ho = *watch.m_it;
+            // cbReasonRemove sets to invalid, cleaned up above on the next call
+            if (VL_UNLIKELY(ho.invalid())) continue;
             VerilatedVpioVar* const varop
                 = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
             if (valueDiffersFromPrev(varop)) {
                 VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
                                             ho.id(), varop->fullname(),
                                             *(static_cast<CData*>(varop->varDatap()))););
-                update.insert(varop);
+                update.push_back(varop);
                 vpi_get_value(ho.cb_datap()->obj, ho.cb_datap()->value);
                 (ho.cb_rtnp())(ho.cb_datap());
                 called = true;
             }
-            if (was_last) break;
         }
         for (const VerilatedVpioVar* const varop : update) updatePrev(varop);
         return called;
@@ -3923,6 +3952,164 @@ vpiHandle vpi_put_value(vpiHandle object, p_vpi_value valuep, p_vpi_time /*time_
     return nullptr;
 }
 
+// Batched value access
+
+// Return the variable when it can be accessed directly by the batched
+// value routines, or nullptr when the per-handle path must be used
+static const VerilatedVpioVar* vl_vpi_batch_var(vpiHandle object, bool isPut) {
+    const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(object);
+    if (VL_UNLIKELY(!vop)) return nullptr;
+    // Whole unpacked arrays (vpiRegArray/vpiNetArray) have no single value
+    if (VL_UNLIKELY(vop->isIndexedDimUnpacked())) return nullptr;
+    const VerilatedVar* const varp = vop->varp();
+    if (VL_UNLIKELY(varp->isForceable())) return nullptr;
+    if (VL_UNLIKELY(isPut && !varp->isPublicRW())) return nullptr;
+    switch (varp->vltype()) {
+    case VLVT_UINT8:
+    case VLVT_UINT16:
+    case VLVT_UINT32:
+    case VLVT_UINT64:
+    case VLVT_WDATA: return vop;
+    default: return nullptr;
+    }
+}
+
+// Report an error and return true if the handle is a whole unpacked array,
+// which the per-handle vpiVectorVal path would otherwise read as element 0
+static bool vl_vpi_batch_array_error(vpiHandle object, const char* funcp) {
+    const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(object);
+    if (VL_LIKELY(!vop || !vop->isIndexedDimUnpacked())) return false;
+    VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported array '%s', index it first", funcp,
+                  vop->fullname());
+    return true;
+}
+
+// Replace the bits of *datap selected by mask
+template <typename T>
+static void vl_vpi_batch_put(T* datap, QData word, QData mask) {
+    *datap = static_cast<T>((*datap & ~mask) | (word & mask));
+}
+
+bool VerilatedVpi::getValues(size_t count, const vpiHandle* handlesp,
+                             uint32_t* wordsp) VL_MT_UNSAFE_ONE {
+    VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: VerilatedVpi::getValues %zu\n", count););
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    for (size_t n = 0; n < count; ++n) {
+        if (const VerilatedVpioVar* const vop = vl_vpi_batch_var(handlesp[n], false)) {
+            const int varBits = vop->bitSize();
+            if (vop->bitOffset() == 0) {
+                // Unshifted, so copy whole storage words and mask the top word
+                switch (vop->varp()->vltype()) {
+                case VLVT_UINT8: *wordsp++ = *vop->varCDatap() & VL_MASK_I(varBits); break;
+                case VLVT_UINT16: *wordsp++ = *vop->varSDatap() & VL_MASK_I(varBits); break;
+                case VLVT_UINT32: *wordsp++ = *vop->varIDatap() & VL_MASK_I(varBits); break;
+                case VLVT_UINT64: {
+                    const QData data = *vop->varQDatap() & VL_MASK_Q(varBits);
+                    *wordsp++ = static_cast<uint32_t>(data);
+                    if (varBits > 32) *wordsp++ = static_cast<uint32_t>(data >> 32ULL);
+                    break;
+                }
+                default: {  // VLVT_WDATA
+                    const int words = VL_WORDS_I(varBits);
+                    std::memcpy(wordsp, vop->varEDatap(), words * sizeof(EData));
+                    wordsp[words - 1] &= VL_MASK_E(varBits);
+                    wordsp += words;
+                }
+                }
+                continue;
+            }
+            if (vop->varp()->vltype() == VLVT_UINT64 && varBits > 32) {
+                const QData data = vl_vpi_get_word(vop, 64, 0);
+                *wordsp++ = static_cast<uint32_t>(data);
+                *wordsp++ = static_cast<uint32_t>(data >> 32ULL);
+                continue;
+            }
+            const int words = VL_WORDS_I(varBits);
+            for (int i = 0; i < words; ++i)
+                *wordsp++ = static_cast<uint32_t>(vl_vpi_get_word(vop, 32, i * 32));
+            continue;
+        }
+        // Forceable signals, parameters and errors take the per-handle path
+        if (VL_UNLIKELY(vl_vpi_batch_array_error(handlesp[n], __func__))) return false;
+        s_vpi_value value{};
+        value.format = vpiVectorVal;
+        vpi_get_value(handlesp[n], &value);
+        if (VL_UNLIKELY(vpi_chk_error(nullptr) >= vpiError || !value.value.vector)) return false;
+        const int words = VL_WORDS_I(vpi_get(vpiSize, handlesp[n]));
+        for (int i = 0; i < words; ++i) *wordsp++ = value.value.vector[i].aval;
+    }
+    return true;
+}
+
+bool VerilatedVpi::putValues(size_t count, const vpiHandle* handlesp,
+                             const uint32_t* wordsp) VL_MT_UNSAFE_ONE {
+    VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: VerilatedVpi::putValues %zu\n", count););
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    if (count) VerilatedVpiImp::evalNeeded(true);
+    for (size_t n = 0; n < count; ++n) {
+        if (const VerilatedVpioVar* const vop = vl_vpi_batch_var(handlesp[n], true)) {
+            const int varBits = vop->bitSize();
+            if (vop->bitOffset() == 0) {
+                // Unshifted, so only the top storage word needs merging
+                switch (vop->varp()->vltype()) {
+                case VLVT_UINT8: {
+                    CData* const datap = vop->varCDatap();
+                    vl_vpi_batch_put(datap, *wordsp++, VL_MASK_I(varBits));
+                    break;
+                }
+                case VLVT_UINT16: {
+                    SData* const datap = vop->varSDatap();
+                    vl_vpi_batch_put(datap, *wordsp++, VL_MASK_I(varBits));
+                    break;
+                }
+                case VLVT_UINT32: {
+                    IData* const datap = vop->varIDatap();
+                    vl_vpi_batch_put(datap, *wordsp++, VL_MASK_I(varBits));
+                    break;
+                }
+                case VLVT_UINT64: {
+                    QData data = *wordsp++;
+                    if (varBits > 32) data |= static_cast<QData>(*wordsp++) << 32ULL;
+                    QData* const datap = vop->varQDatap();
+                    vl_vpi_batch_put(datap, data, VL_MASK_Q(varBits));
+                    break;
+                }
+                default: {  // VLVT_WDATA
+                    const int words = VL_WORDS_I(varBits);
+                    EData* const datap = vop->varEDatap();
+                    std::memcpy(datap, wordsp, (words - 1) * sizeof(EData));
+                    vl_vpi_batch_put(datap + words - 1, wordsp[words - 1], VL_MASK_E(varBits));
+                    wordsp += words;
+                }
+                }
+                continue;
+            }
+            if (vop->varp()->vltype() == VLVT_UINT64 && varBits > 32) {
+                vl_vpi_put_word(vop, static_cast<QData>(wordsp[1]) << 32ULL | wordsp[0], 64, 0);
+                wordsp += 2;
+                continue;
+            }
+            const int words = VL_WORDS_I(varBits);
+            for (int i = 0; i < words; ++i) vl_vpi_put_word(vop, *wordsp++, 32, i * 32);
+            continue;
+        }
+        // Forceable signals and errors take the per-handle path
+        if (VL_UNLIKELY(vl_vpi_batch_array_error(handlesp[n], __func__))) return false;
+        static thread_local std::vector<t_vpi_vecval> t_vec;
+        const int words = VL_WORDS_I(vpi_get(vpiSize, handlesp[n]));
+        if (VL_UNLIKELY(words <= 0)) return false;
+        t_vec.resize(words);
+        for (int i = 0; i < words; ++i) t_vec[i] = t_vpi_vecval{*wordsp++, 0};
+        s_vpi_value value{};
+        value.format = vpiVectorVal;
+        value.value.vector = t_vec.data();
+        if (VL_UNLIKELY(!vpi_put_value(handlesp[n], &value, nullptr, vpiNoDelay))) return false;
+    }
+    return true;
+}
+
 bool vl_check_array_format(const VerilatedVar* varp, const p_vpi_arrayvalue arrayvalue_p,
                            const char* fullname) {
     switch (arrayvalue_p->format) {
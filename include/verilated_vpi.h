@@ -64,6 +64,19 @@ public:
     static void clearEvalNeeded() VL_MT_UNSAFE_ONE;
     /// Perform inertially delayed puts
     static void doInertialPuts() VL_MT_UNSAFE_ONE;
+    /// Read the values of count signal handles into wordsp, as if by
+    /// vpi_get_value with vpiVectorVal format.  Each signal's aval words
+    /// follow the previous signal's, VL_WORDS_I(vpiSize) words per signal,
+    /// least significant word first.  Returns false on the first handle
+    /// that cannot be read; vpi_chk_error describes the failure.
+    static bool getValues(size_t count, const vpiHandle* handlesp,
+                          uint32_t* wordsp) VL_MT_UNSAFE_ONE;
+    /// Write the values of count signal handles from wordsp, as if by
+    /// vpi_put_value with vpiVectorVal format and vpiNoDelay.  Words are
+    /// laid out as for getValues.  Returns false on the first handle that
+    /// cannot be written; vpi_chk_error describes the failure.
+    static bool putValues(size_t count, const vpiHandle* handlesp,
+                          const uint32_t* wordsp) VL_MT_UNSAFE_ONE;
 
     // Self test, for internal use only
     static void selfTest() VL_MT_UNSAFE_ONE;
@@ -502,6 +502,7 @@ public:
         SCOPEPTR,
         CHARPTR,
         MTASKSTATE,
+        MTASK_READY_QUEUE,
         DELAY_SCHEDULER,
         TRIGGER_SCHEDULER,
         DYNAMIC_TRIGGER_SCHEDULER,
@@ -537,6 +538,7 @@ public:
                                             "VerilatedScope*",
                                             "char*",
                                             "VlMTaskState",
+                                            "VlMTaskReadyQueue",
                                             "VlDelayScheduler",
                                             "VlTriggerScheduler",
                                             "VlDynamicTriggerScheduler",
@@ -569,6 +571,7 @@ public:
                                             "dpiScope",
                                             "const char*",
                                             "%E-mtaskstate",
+                                            "%E-mtask-readyq",
                                             "%E-dly-sched",
                                             "%E-trig-sched",
                                             "%E-dyn-sched",
@@ -613,6 +616,7 @@ public:
         case SCOPEPTR: return 0;  // opaque
         case CHARPTR: return 0;  // opaque
         case MTASKSTATE: return 0;  // opaque
+        case MTASK_READY_QUEUE: return 0;  // opaque
         case DELAY_SCHEDULER: return 0;  // opaque
         case TRIGGER_SCHEDULER: return 0;  // opaque
         case DYNAMIC_TRIGGER_SCHEDULER: return 0;  // opaque
@@ -658,16 +662,17 @@ public:
     }
     bool isOpaque() const VL_MT_SAFE {  // IE not a simple number we can bit optimize
         return (m_e == EVENT || m_e == STRING || m_e == SCOPEPTR || m_e == CHARPTR
-                || m_e == MTASKSTATE || m_e == DELAY_SCHEDULER || m_e == TRIGGER_SCHEDULER
-                || m_e == DYNAMIC_TRIGGER_SCHEDULER || m_e == FORK_SYNC || m_e == PROCESS_REFERENCE
-                || m_e == RANDOM_GENERATOR || m_e == RANDOM_STDGENERATOR || m_e == DOUBLE
-                || m_e == UNTYPED);
+                || m_e == MTASKSTATE || m_e == MTASK_READY_QUEUE || m_e == DELAY_SCHEDULER
+                || m_e == TRIGGER_SCHEDULER || m_e == DYNAMIC_TRIGGER_SCHEDULER
+                || m_e == FORK_SYNC || m_e == PROCESS_REFERENCE || m_e == RANDOM_GENERATOR
+                || m_e == RANDOM_STDGENERATOR || m_e == DOUBLE || m_e == UNTYPED);
     }
     bool isCHandle() const VL_MT_SAFE { return m_e == CHANDLE; }
     bool isDouble() const VL_MT_SAFE { return m_e == DOUBLE; }
     bool isEvent() const { return m_e == EVENT; }
     bool isString() const VL_MT_SAFE { return m_e == STRING; }
     bool isMTaskState() const VL_MT_SAFE { return m_e == MTASKSTATE; }
+    bool isMTaskReadyQueue() const VL_MT_SAFE { return m_e == MTASK_READY_QUEUE; }
     // Does this represent a C++ LiteralType? (can be constexpr)
     bool isLiteralType() const VL_MT_SAFE {
         switch (m_e) {
@@ -709,6 +714,7 @@ public:
             /* SCOPEPTR:                  */ "",  // Should not be traced
             /* CHARPTR:                   */ "",  // Should not be traced
             /* MTASKSTATE:                */ "",  // Should not be traced
+            /* MTASK_READY_QUEUE:         */ "",  // Should not be traced
             /* DELAY_SCHEDULER:           */ "",  // Should not be traced
             /* TRIGGER_SCHEDULER:         */ "",  // Should not be traced
             /* DYNAMIC_TRIGGER_SCHEDULER: */ "",  // Should not be traced
@@ -898,6 +904,7 @@ public:
         RANDOMIZER_SOFT,
         RANDOMIZER_UNIQUE,
         RANDOMIZER_MARK_RANDC,
+        RANDOMIZER_NATIVE_SOLVE,
         RANDOMIZER_SOLVE_BEFORE,
         RANDOMIZER_PIN_VAR,
         RANDOMIZER_WRITE_VAR,
@@ -1052,6 +1059,7 @@ inline std::ostream& operator<<(std::ostream& os, const VCMethod& rhs) {
            {RANDOMIZER_SOFT, "soft", false}, \
            {RANDOMIZER_UNIQUE, "rand_unique", false}, \
            {RANDOMIZER_MARK_RANDC, "markRandc", false}, \
+           {RANDOMIZER_NATIVE_SOLVE, "nativeSolve", false}, \
            {RANDOMIZER_SOLVE_BEFORE, "solveBefore", false}, \
            {RANDOMIZER_PIN_VAR, "pin_var", false}, \
            {RANDOMIZER_WRITE_VAR, "write_var", false}, \
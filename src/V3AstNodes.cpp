@@ -1261,6 +1261,8 @@ AstNodeDType::CTypeRecursed AstNodeDType::cTypeRecurse(bool compound, bool packe
             info.m_type = "std::string";
         } else if (bdtypep->keyword().isMTaskState()) {
             info.m_type = "VlMTaskVertex";
+        } else if (bdtypep->keyword().isMTaskReadyQueue()) {
+            info.m_type = "VlMTaskReadyQueue";
         } else if (bdtypep->isDelayScheduler()) {
             info.m_type = "VlDelayScheduler";
         } else if (bdtypep->isTriggerScheduler()) {
@@ -78,6 +78,16 @@ public:
                && !(VN_IS(dtp, NodeUOrStructDType) && !VN_CAST(dtp, NodeUOrStructDType)->packed())
                && (varp->basicp() && !varp->basicp()->isOpaque());  // Aggregates can't be anon
     }
+    // Return declaration of a coverage counter array with the given number of bins.
+    // Multithreaded models get a row of counters per thread, each padded by a
+    // cache line so no two threads ever increment counters in the same line.
+    static string coverageArrayDecl(int bins) {
+        if (v3Global.opt.threads() <= 1) return "uint32_t __Vcoverage[" + cvtToStr(bins) + "]";
+        constexpr int lineCounters = 64 / sizeof(uint32_t);  // VL_CACHE_LINE_BYTES
+        const int row = (bins + 2 * lineCounters - 1) / lineCounters * lineCounters;
+        return "std::atomic<uint32_t> __Vcoverage[" + cvtToStr(v3Global.opt.threads()) + "]["
+               + cvtToStr(row) + "]";
+    }
     static bool isConstPoolMod(const AstNode* modp) {
         return modp == v3Global.rootp()->constPoolp()->modp();
     }
@@ -238,6 +238,171 @@ bool EmitCFunc::displayEmitHeader(AstNode* nodep) {
     return isStmt;
 }
 
+bool EmitCFunc::displaySpecialized(AstNode* nodep, AstSFormatF* fmtp, const string& vformat,
+                                   AstNode* exprsp) {
+    // Parse the format as _vl_vsformat would, into literal text and conversions
+    struct Piece final {
+        string m_text;  // Literal text, if no m_method
+        const char* m_method = nullptr;  // VlFormat method for a conversion
+        AstNode* m_argp = nullptr;  // Converted argument, nullptr for %m
+        int m_width = -1;  // Field width, -1 if none
+        bool m_signed = false;  // VlFormat::F_SIGNED
+        bool m_left = false;  // VlFormat::F_LEFT
+        bool m_zero = false;  // VlFormat::F_ZERO
+    };
+    std::vector<Piece> pieces;
+    const auto addText = [&](const string& text) {
+        if (pieces.empty() || pieces.back().m_method) pieces.emplace_back();
+        pieces.back().m_text += text;
+    };
+    bool inPct = false;
+    bool left = false;  // Like _vl_vsformat, once set applies to later conversions too
+    bool zero = false;
+    int width = -1;
+    size_t pctPos = 0;  // Position of the most recent '%'
+    AstNode* argp = exprsp;
+    for (size_t pos = 0; pos < vformat.size(); ++pos) {
+        const char ch = vformat[pos];
+        if (!inPct && ch == '%') {
+            inPct = true;
+            zero = false;
+            width = -1;
+            pctPos = pos;
+            continue;
+        }
+        if (!inPct) {
+            addText(string(1, ch));
+            continue;
+        }
+        if (std::isdigit(ch)) {
+            if (pos == pctPos + 1 && ch == '0') zero = true;
+            width = std::max(width, 0) * 10 + (ch - '0');
+            if (width > 0xffff) return false;
+            continue;
+        }
+        if (ch == '-') {
+            left = true;
+            continue;
+        }
+        inPct = false;
+        const char fmt = std::tolower(ch);
+        if (fmt == '%') {
+            addText("%");
+            continue;
+        }
+        if (fmt == 'l') {
+            addText("----");  // Library - compile-time only
+            continue;
+        }
+        Piece piece;
+        piece.m_width = width;
+        piece.m_left = left;
+        piece.m_zero = zero;
+        if (fmt == 'm') {
+            piece.m_method = "scope";
+            pieces.push_back(piece);
+            continue;
+        }
+        if (!fmt || !std::strchr("bcdhosx", fmt) || !argp) return false;  // %t, %p, ...
+        AstSFormatArg* const fargp = VN_CAST(argp, SFormatArg);
+        AstNode* const subargp = fargp ? fargp->exprp() : argp;
+        const VFormatAttr formatAttr = AstSFormatArg::formatAttrDefauled(fargp, subargp->dtypep());
+        const AstNodeDType* const dtypep = subargp->dtypep()->skipRefp();
+        if (VN_IS(subargp, StreamR)) return false;
+        if (formatAttr.isString()) {
+            // Strings print as %s for every conversion but %x
+            if (fmt == 'x' || !dtypep->isString()) return false;
+            piece.m_method = "str";
+        } else {
+            if (!formatAttr.isSigned() && !formatAttr.isUnsigned()) return false;
+            if (dtypep->isString() || dtypep->isDouble() || subargp->isWide()) return false;
+            piece.m_signed = formatAttr.isSigned();
+            switch (fmt) {
+            case 'b': piece.m_method = "bin"; break;
+            case 'c': piece.m_method = "chr"; break;
+            case 'd': piece.m_method = "dec"; break;
+            case 'o': piece.m_method = "oct"; break;
+            case 's': piece.m_method = "chars"; break;
+            default: piece.m_method = "hex"; break;
+            }
+        }
+        piece.m_argp = subargp;
+        pieces.push_back(piece);
+        argp = argp->nextp();
+    }
+    if (inPct || argp) return false;
+    // Plain text is already cheap for _vl_vsformat
+    if (std::none_of(pieces.begin(), pieces.end(),
+                     [](const Piece& piece) { return piece.m_method; }))
+        return false;
+
+    const AstDisplay* const displayp = VN_CAST(nodep, Display);
+    const AstSFormat* const sformatp = VN_CAST(nodep, SFormat);
+    if (displayp && displayp->filep()) {
+        putns(nodep, "VL_FWRITEF_S(");
+        iterateConst(displayp->filep());
+        puts(",");
+    } else if (displayp) {
+        putns(nodep, "VL_WRITEF_S(");
+    } else if (sformatp) {
+        putns(nodep, "VL_SFORMAT_S(");
+        if (!sformatp->lhsp()->dtypep()->isString()) {
+            puts(cvtToStr(sformatp->lhsp()->widthMin()));
+            putbs(",");
+        }
+        iterateConst(sformatp->lhsp());
+        emitDatap(sformatp->lhsp());
+        putbs(",");
+    } else {
+        UASSERT_OBJ(VN_IS(nodep, SFormatF), nodep, "Unknown displayEmit node type");
+    }
+    if (displayp || sformatp) {
+        puts("VlFormat{}");
+    } else {
+        putns(nodep, "VlFormat{}");
+    }
+    for (const Piece& piece : pieces) {
+        ofp()->indentInc();
+        ofp()->putbs("");
+        if (!piece.m_method) {
+            puts(".text(");
+            ofp()->putsQuoted(piece.m_text);
+            puts(")");
+        } else if (!piece.m_argp) {
+            AstScopeName* const scopenamep = fmtp ? fmtp->scopeNamep() : nullptr;
+            UASSERT_OBJ(scopenamep, nodep, "Display with %m but no AstScopeName");
+            puts(".scope(vlSymsp->name(),");
+            ofp()->putsQuoted(scopenamep->scopePrettySymName());
+            puts(")");
+        } else {
+            const string method = piece.m_method;
+            puts("." + method + "(");
+            if (method != "str" && method != "chr") {
+                puts(cvtToStr(piece.m_argp->widthMin()) + ",");
+            }
+            iterateConst(piece.m_argp);
+            if (method != "chr") {
+                // Flags by name, so the values are defined only by VlFormat
+                string flags;
+                if (piece.m_signed) flags += "|VlFormat::F_SIGNED";
+                if (piece.m_left) flags += "|VlFormat::F_LEFT";
+                if (piece.m_zero) flags += "|VlFormat::F_ZERO";
+                flags = flags.empty() ? "0" : flags.substr(1);
+                puts("," + cvtToStr(piece.m_width) + "," + flags);
+            }
+            puts(")");
+        }
+        ofp()->indentDec();
+    }
+    puts(".result()");
+    if (displayp || sformatp) {
+        puts(");\n");
+    } else {
+        puts(" ");
+    }
+    return true;
+}
+
 void EmitCFunc::displayNode(AstNode* nodep, AstSFormatF* fmtp,  // fmtp is nullptr for AstScan
                             const string& vformat, AstNode* exprsp, bool isScan) {
     // Check format, if it exists
@@ -281,6 +446,9 @@ void EmitCFunc::displayNode(AstNode* nodep, AstSFormatF* fmtp,  // fmtp is nullp
     if (vformat.empty() && VN_IS(nodep, Display))  // not fscanf etc, as they need to return value
         return;  // NOP
 
+    // Constant formats are parsed now, rather than by _vl_vsformat on every call
+    if (!exprFormat && !isScan && displaySpecialized(nodep, fmtp, vformat, exprsp)) return;
+
     const bool isStmt = displayEmitHeader(nodep);
 
     if (exprFormat) {
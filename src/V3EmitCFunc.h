@@ -176,11 +176,31 @@ protected:
             puts("vlSymsp->__Vcoverage");
         }
     }
+    // Emit the counter argument(s) of a coverage insert call
+    void putCoverageInsertCount(AstNodeCoverDecl* const declp, bool forceGlobal = false) {
+        putCoverageArray(declp, forceGlobal);
+        if (v3Global.opt.threads() > 1) puts("[0]");
+        puts(" + ");
+        puts(cvtToStr(coverageBinNum(declp, forceGlobal)));
+        if (v3Global.opt.threads() > 1) {
+            puts(", VL_COV_SHARD_STRIDE(");
+            putCoverageArray(declp, forceGlobal);
+            puts(")");
+        }
+    }
+    // Emit the counter array of the current thread's shard
+    void putCoverageShard(AstNodeCoverDecl* const declp) {
+        if (v3Global.opt.threads() > 1) {
+            puts("VL_COV_SHARD(");
+            putCoverageArray(declp);
+            puts(")");
+        } else {
+            putCoverageArray(declp);
+        }
+    }
     void emitCoverOtherDeclInsert(AstCoverOtherDecl* nodep, bool forceGlobal = false) {
         putns(nodep, "vlSelf->__vlCoverInsert(");  // As Declared in emitCoverageDecl
-        putCoverageArray(nodep, forceGlobal);
-        puts(" + ");
-        puts(cvtToStr(coverageBinNum(nodep, forceGlobal)));
+        putCoverageInsertCount(nodep, forceGlobal);
         // first controls whether duplicate module instances are collapsed in
         // the default coverage view. The following flag says whether countp
         // points to an object-local counter; only those counters must be kept
@@ -219,6 +239,9 @@ public:
     bool displayEmitHeader(AstNode* nodep);
     void displayNode(AstNode* nodep, AstSFormatF* fmtp, const string& vformat, AstNode* exprsp,
                      bool isScan);
+    // Emit a constant format as VlFormat calls; false if it needs VL_*_NX at runtime
+    bool displaySpecialized(AstNode* nodep, AstSFormatF* fmtp, const string& vformat,
+                            AstNode* exprsp);
 
     bool emitSimpleOk(AstNodeExpr* nodep);
     void emitIQW(const AstNode* nodep) {
@@ -900,9 +923,7 @@ public:
         puts(", ");
         puts(cvtToStr(nodep->range().ranged()));
         puts(", ");
-        putCoverageArray(nodep);
-        puts(" + ");
-        puts(cvtToStr(coverageBinNum(nodep)));
+        putCoverageInsertCount(nodep);
         // first controls whether duplicate module instances are collapsed in
         // the default coverage view. The following flag says whether countp
         // points to an object-local counter; only those counters must be kept
@@ -929,7 +950,7 @@ public:
         if (VN_IS(nodep->declp(), CoverOtherDecl)) {
             if (v3Global.opt.threads() > 1) {
                 putns(nodep, "");
-                putCoverageArray(nodep->declp());
+                putCoverageShard(nodep->declp());
                 puts("[");
                 puts(cvtToStr(coverageBinNum(nodep->declp())));
                 puts("].fetch_add(1, std::memory_order_relaxed);\n");
@@ -955,7 +976,7 @@ public:
             puts(", ");
             // Toggle update uses the same object-local counter array that
             // __vlCoverToggleInsert registered.
-            putCoverageArray(nodep->declp());
+            putCoverageShard(nodep->declp());
             puts(" + ");
             puts(cvtToStr(coverageBinNum(nodep->declp())));
             puts(", ");
@@ -154,10 +154,8 @@ class EmitCHeader final : public EmitCConstInit {
             // contain emitted coverage declarations.
             const int coverBins = CoverCountVisitor{modp}.bins();
             if (coverBins) {
-                puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-                puts(" __Vcoverage[");
-                puts(std::to_string(coverBins));
-                puts("]{};\n");
+                puts(EmitCUtil::coverageArrayDecl(coverBins));
+                puts("{};\n");
             }
         }
     }
@@ -221,8 +219,9 @@ class EmitCHeader final : public EmitCConstInit {
         if (v3Global.opt.coverage() && !VN_IS(modp, Class)) {
             decorateFirst(first, section);
             puts("void __vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, bool localCounter, const char* filenamep, int lineno, "
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>* countp, size_t shardStride"
+                                            : "uint32_t* countp");
+            puts(", bool enable, bool localCounter, const char* filenamep, int lineno, "
                  "int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp,\n");
@@ -233,8 +232,9 @@ class EmitCHeader final : public EmitCConstInit {
         if (v3Global.opt.coverageToggle() && !VN_IS(modp, Class)) {
             decorateFirst(first, section);
             puts("void __vlCoverToggleInsert(int begin, int end, bool ranged, ");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, bool localCounter, const char* filenamep, int lineno, "
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>* countp, size_t shardStride"
+                                            : "uint32_t* countp");
+            puts(", bool enable, bool localCounter, const char* filenamep, int lineno, "
                  "int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp);\n");
         }
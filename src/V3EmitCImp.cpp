@@ -110,7 +110,8 @@ class EmitCImp final : public EmitCFunc {
                 if (const AstVar* const varp = VN_CAST(nodep, Var)) {
                     if (const AstBasicDType* const dtypep
                         = VN_CAST(varp->dtypeSkipRefp(), BasicDType)) {
-                        if (dtypep->keyword().isMTaskState()) {
+                        if (dtypep->keyword().isMTaskState()
+                            || dtypep->keyword().isMTaskReadyQueue()) {
                             puts(sepp);
                             putns(varp, varp->nameProtect());
                             puts("(");
@@ -170,6 +171,36 @@ class EmitCImp final : public EmitCFunc {
         }
         puts("}\n");
     }
+    void emitCoverInsertCall() {
+        // Global-counter users still redirect later duplicate instances
+        // to fake_zero_count for default collapsed coverage. Object-local
+        // counters must keep the real pointer so forcePerInstance can
+        // report each hierarchy independently.
+        if (v3Global.opt.threads() > 1) {
+            // Sharded counters: count32p is the counter in shard 0, the
+            // same counter of the next thread's shard is shardStride later
+            puts("if (!enable && !localCounter) {\n");
+            puts("count32p = fake_zero_count;\n");
+            puts("shardStride = 1;\n");
+            puts("}\n");
+            puts("VL_COVER_INSERT_SHARDS(vlSymsp->_vm_contextp__->coveragep(), vlNamep, ");
+            puts("count32p, " + cvtToStr(v3Global.opt.threads()));
+            puts(", shardStride,");
+        } else {
+            puts("if (!enable && !localCounter) count32p = &fake_zero_count;\n");
+            puts("*count32p = 0;\n");
+            puts("VL_COVER_INSERT(vlSymsp->_vm_contextp__->coveragep(), vlNamep, count32p,");
+        }
+    }
+    void emitCoverFakeZeroCount() {
+        // static doesn't need save-restore as is constant
+        if (v3Global.opt.threads() > 1) {
+            puts("static uint32_t fake_zero_count[" + cvtToStr(v3Global.opt.threads())
+                 + "] = {};\n");
+        } else {
+            puts("static uint32_t fake_zero_count = 0;\n");
+        }
+    }
     void emitCoverageImp() {
         // Rather than putting out VL_COVER_INSERT calls directly, we do it via this
         // function. This gets around gcc slowness constructing all of the template
@@ -177,8 +208,9 @@ class EmitCImp final : public EmitCFunc {
         if (v3Global.opt.coverage()) {
             puts("\n// Coverage\n");
             puts("void " + EmitCUtil::prefixNameProtect(m_modp) + "::__vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, bool localCounter, const char* filenamep, int lineno, "
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>* countp, size_t shardStride"
+                                            : "uint32_t* countp");
+            puts(", bool enable, bool localCounter, const char* filenamep, int lineno, "
                  "int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp,\n");
@@ -190,17 +222,10 @@ class EmitCImp final : public EmitCFunc {
             } else {
                 puts("uint32_t* count32p = countp;\n");
             }
-            // static doesn't need save-restore as is constant
-            puts("static uint32_t fake_zero_count = 0;\n");
+            emitCoverFakeZeroCount();
             puts("std::string fullhier = std::string{vlNamep} + hierp;\n");
             puts("if (!fullhier.empty() && fullhier[0] == '.') fullhier = fullhier.substr(1);\n");
-            // Global-counter users still redirect later duplicate instances
-            // to fake_zero_count for default collapsed coverage. Object-local
-            // counters must keep the real pointer so forcePerInstance can
-            // report each hierarchy independently.
-            puts("if (!enable && !localCounter) count32p = &fake_zero_count;\n");
-            puts("*count32p = 0;\n");
-            puts("VL_COVER_INSERT(vlSymsp->_vm_contextp__->coveragep(), vlNamep, count32p,");
+            emitCoverInsertCall();
             puts("  \"filename\",filenamep,");
             puts("  \"lineno\",lineno,");
             puts("  \"column\",column,\n");
@@ -218,8 +243,9 @@ class EmitCImp final : public EmitCFunc {
             puts("\n// Toggle Coverage\n");
             puts("void " + EmitCUtil::prefixNameProtect(m_modp) + "::__vlCoverToggleInsert(");
             puts("int begin, int end, bool ranged, ");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-            puts("* countp, bool enable, bool localCounter, const char* filenamep, int lineno, "
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>* countp, size_t shardStride"
+                                            : "uint32_t* countp");
+            puts(", bool enable, bool localCounter, const char* filenamep, int lineno, "
                  "int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp) {\n");
             if (v3Global.opt.threads() > 1) {
@@ -234,20 +260,13 @@ class EmitCImp final : public EmitCFunc {
             } else {
                 puts("uint32_t* count32p = countp;\n");
             }
-            // static doesn't need save-restore as is constant
-            puts("static uint32_t fake_zero_count = 0;\n");
+            emitCoverFakeZeroCount();
             puts("std::string fullhier = std::string{vlNamep} + hierp;\n");
             puts("if (!fullhier.empty() && fullhier[0] == '.') fullhier = fullhier.substr(1);\n");
             puts("std::string commentWithIndex = commentp;\n");
             puts("if (ranged) commentWithIndex += '[' + std::to_string(i) + ']';\n");
             puts("commentWithIndex += j ? \":0->1\" : \":1->0\";\n");
-            // Global-counter users still redirect later duplicate instances
-            // to fake_zero_count for default collapsed coverage. Object-local
-            // counters must keep the real pointer so forcePerInstance can
-            // report each hierarchy independently.
-            puts("if (!enable && !localCounter) count32p = &fake_zero_count;\n");
-            puts("*count32p = 0;\n");
-            puts("VL_COVER_INSERT(vlSymsp->_vm_contextp__->coveragep(), vlNamep, count32p,");
+            emitCoverInsertCall();
             puts("  \"filename\",filenamep,");
             puts("  \"lineno\",lineno,");
             puts("  \"column\",column,\n");
@@ -333,7 +352,10 @@ class EmitCImp final : public EmitCFunc {
                             }
                             const AstBasicDType* const basicp = elementp->basicp();
                             // Do not save MTask state, only matters within an evaluation
-                            if (basicp && basicp->keyword().isMTaskState()) continue;
+                            if (basicp
+                                && (basicp->keyword().isMTaskState()
+                                    || basicp->keyword().isMTaskReadyQueue()))
+                                continue;
                             // Want to detect types that are represented as arrays
                             // (i.e. packed types of more than 64 bits).
                             if (elementp->isWide()
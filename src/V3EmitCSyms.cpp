@@ -978,10 +978,8 @@ void EmitCSyms::emitSymHdr() {
 
     if (m_coverBins) {
         puts("\n// COVERAGE\n");
-        puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-        puts(" __Vcoverage[");
-        puts(std::to_string(m_coverBins));
-        puts("];\n");
+        puts(EmitCUtil::coverageArrayDecl(m_coverBins));
+        puts(";\n");
     }
 
     if (!m_scopeNames.empty()) {  // Scope names
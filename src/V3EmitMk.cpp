@@ -842,10 +842,11 @@ class EmitMkHierVerilation final {
         of.puts(".SUFFIXES:\n");
         of.puts(".PHONY: hier_build hier_verilation hier_launch_verilator\n");
 
-        of.puts("# Libraries of hierarchical blocks\n");
+        // Make builds prerequisites in the listed order, so longest chains start first
+        const std::vector<const V3HierBlock*> blockps = m_graphp->criticalPathOrder();
+        of.puts("# Libraries of hierarchical blocks, in critical path order\n");
         of.puts("VM_HIER_LIBS := \\\n");
-        for (const V3GraphVertex& vtx : m_graphp->vertices()) {
-            const V3HierBlock* const blockp = vtx.as<V3HierBlock>();
+        for (const V3HierBlock* const blockp : blockps) {
             of.puts("  " + blockp->hierLibFilename(true) + " \\\n");
         }
         of.puts("\n");
@@ -870,8 +871,7 @@ class EmitMkHierVerilation final {
             of.puts(v3Global.opt.prefix()
                     + ".mk: $(VM_HIER_INPUT_FILES) $(VM_HIER_VERILOG_LIBS) ");
             of.puts(V3Os::filenameNonDir(argsFile) + " ");
-            for (const V3GraphVertex& vtx : m_graphp->vertices()) {
-                const V3HierBlock* const blockp = vtx.as<V3HierBlock>();
+            for (const V3HierBlock* const blockp : blockps) {
                 of.puts(blockp->hierWrapperFilename(true) + " ");
             }
             of.puts("\n");
@@ -880,15 +880,15 @@ class EmitMkHierVerilation final {
 
         // Rules to process hierarchical blocks
         of.puts("\n# Verilate hierarchical blocks\n");
-        for (const V3GraphVertex& vtx : m_graphp->vertices()) {
-            const V3HierBlock* const blockp = vtx.as<V3HierBlock>();
+        for (const V3HierBlock* const blockp : blockps) {
             const string prefix = blockp->hierPrefix();
             const string argsFilename = blockp->commandArgsFilename(false);
             of.puts(blockp->hierGeneratedFilenames(true));
             of.puts(": $(VM_HIER_INPUT_FILES) $(VM_HIER_VERILOG_LIBS) ");
             of.puts(V3Os::filenameNonDir(argsFilename) + " ");
-            for (const V3GraphEdge& edge : blockp->outEdges()) {
-                const V3HierBlock* const dependencyp = edge.top()->as<V3HierBlock>();
+            const std::vector<const V3HierBlock*> dependencyps
+                = blockp->dependenciesCriticalPathOrder();
+            for (const V3HierBlock* const dependencyp : dependencyps) {
                 of.puts(dependencyp->hierWrapperFilename(true) + " ");
             }
             of.puts("\n");
@@ -899,8 +899,7 @@ class EmitMkHierVerilation final {
             of.puts(": ");
             of.puts(blockp->hierMkFilename(true));
             of.puts(" ");
-            for (const V3GraphEdge& edge : blockp->outEdges()) {
-                const V3HierBlock* const dependencyp = edge.top()->as<V3HierBlock>();
+            for (const V3HierBlock* const dependencyp : dependencyps) {
                 of.puts(dependencyp->hierLibFilename(true));
                 of.puts(" ");
             }
@@ -1006,6 +1006,170 @@ const std::vector<AstCFunc*> createThreadFunctions(const ThreadSchedule& schedul
     return funcps;
 }
 
+// Dynamic scheduling (--threads-schedule dynamic): rather than running a fixed sequence of mtasks
+// on each thread, every thread runs the same entry point, which executes mtasks from a shared
+// ready queue. Each mtask is wrapped in a function that runs the mtask, then signals its
+// successors, and publishes any successor that became ready. The static schedule is only used to
+// order the initial ready list and the successors, so higher priority mtasks start first.
+const std::vector<AstCFunc*> createDynamicThreadFunctions(AstExecGraph* const execGraphp,
+                                                          const ThreadSchedule& schedule) {
+    AstScope* const scopep = v3Global.rootp()->topScopep()->scopep();
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string& tag = execGraphp->name();
+    const string scheduleName = "__s" + cvtToStr(schedule.id());
+    AstBasicDType* const s_mtaskStateDtypep
+        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
+
+    // Gather the mtasks of this schedule, highest priority first
+    std::vector<const ExecMTask*> mtasks;
+    for (const std::vector<const ExecMTask*>& thread : schedule.m_threads) {
+        mtasks.insert(mtasks.end(), thread.begin(), thread.end());
+    }
+    std::stable_sort(mtasks.begin(), mtasks.end(), [](const ExecMTask* ap, const ExecMTask* bp) {
+        if (ap->priority() != bp->priority()) return ap->priority() > bp->priority();
+        return ap->id() < bp->id();
+    });
+
+    // Create the ready queue
+    const string queueName = "__Vm_mtaskready_" + cvtToStr(schedule.id()) + tag;
+    {
+        AstBasicDType* const dtypep = v3Global.rootp()->typeTablep()->findBasicDType(
+            fl, VBasicDTypeKwd::MTASK_READY_QUEUE);
+        AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, queueName, dtypep};
+        varp->isConst(true);
+        varp->valuep(new AstConst{fl, static_cast<uint32_t>(mtasks.size())});
+        varp->protect(false);  // Do not protect as we have references in text
+        modp->addStmtsp(varp);
+    }
+
+    // Number of upstream dependencies of an mtask within this schedule
+    const auto upstreamDeps = [&](const ExecMTask* mtaskp) {
+        uint32_t result = 0;
+        for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+            if (schedule.contains(edge.fromp()->as<ExecMTask>())) ++result;
+        }
+        return result;
+    };
+
+    // Create the wrapper function of each mtask, so successors can refer to them
+    std::unordered_map<const ExecMTask*, AstCFunc*> wrappers;
+    for (const ExecMTask* const mtaskp : mtasks) {
+        const string name{"__Vmtask__" + tag + scheduleName + "__m" + cvtToStr(mtaskp->id())};
+        AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+        modp->addStmtsp(funcp);
+        funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+        funcp->isLoose(true);
+        funcp->entryPoint(true);
+        funcp->argTypes("void* voidSelf, bool even_cycle");
+        wrappers.emplace(mtaskp, funcp);
+    }
+
+    // Add code publishing the given mtask as ready
+    const auto addPush = [&](AstCStmt* cstmtp, const ExecMTask* mtaskp) {
+        cstmtp->add("vlSelf->" + queueName + ".push(");
+        cstmtp->add(new AstAddrOfCFunc{fl, wrappers.at(mtaskp)});
+        cstmtp->add(");");
+    };
+
+    for (const ExecMTask* const mtaskp : mtasks) {
+        AstCFunc* const funcp = wrappers.at(mtaskp);
+        const auto addCStmt = [=](const string& stmt) -> void {  //
+            funcp->addStmtsp(new AstCStmt{fl, stmt});
+        };
+
+        // Mtasks with more than one upstream dependency count completions
+        const uint32_t nDependencies = upstreamDeps(mtaskp);
+        if (nDependencies > 1) {
+            const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
+            AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, s_mtaskStateDtypep};
+            varp->isConst(true);
+            varp->valuep(new AstConst{fl, nDependencies});
+            varp->protect(false);  // Do not protect as we have references in text
+            modp->addStmtsp(varp);
+        }
+
+        funcp->addStmtsp(new AstCStmt{fl, EmitCUtil::voidSelfAssign(modp)});
+        funcp->addStmtsp(new AstCStmt{fl, EmitCUtil::symClassAssign()});
+
+        if (v3Global.opt.profPgo()) {
+            // No lock around startCounter, as counter numbers are unique per mtask
+            addCStmt("vlSymsp->_vm_pgoProfiler.startCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Call the MTask function
+        AstCCall* const callp = new AstCCall{fl, mtaskp->funcp()};
+        callp->selfPointer(VSelfPointerText{VSelfPointerText::VlSyms{}, scopep->nameDotless()});
+        callp->dtypeSetVoid();
+        funcp->addStmtsp(callp->makeStmt());
+
+        if (v3Global.opt.profPgo()) {
+            addCStmt("vlSymsp->_vm_pgoProfiler.stopCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Publish successors that are now ready, highest priority first
+        std::vector<const ExecMTask*> nexts;
+        for (const V3GraphEdge& edge : mtaskp->outEdges()) {
+            const ExecMTask* const nextp = edge.top()->as<ExecMTask>();
+            if (schedule.contains(nextp)) nexts.push_back(nextp);
+        }
+        std::stable_sort(nexts.begin(), nexts.end(),
+                         [](const ExecMTask* ap, const ExecMTask* bp) {
+                             return ap->priority() > bp->priority();
+                         });
+        for (const ExecMTask* const nextp : nexts) {
+            AstCStmt* const cstmtp = new AstCStmt{fl};
+            funcp->addStmtsp(cstmtp);
+            if (upstreamDeps(nextp) == 1) {
+                addPush(cstmtp, nextp);
+            } else {
+                cstmtp->add("if (vlSelf->__Vm_mtaskstate_" + cvtToStr(nextp->id())
+                            + ".signalUpstreamDone(even_cycle)) ");
+                addPush(cstmtp, nextp);
+            }
+        }
+    }
+
+    // Reset the ready queue and publish mtasks without upstream dependencies before starting
+    execGraphp->addStmtsp(new AstCStmt{fl, "vlSelf->" + queueName + ".reset();"});
+    for (const ExecMTask* const mtaskp : mtasks) {
+        if (upstreamDeps(mtaskp)) continue;
+        AstCStmt* const cstmtp = new AstCStmt{fl};
+        execGraphp->addStmtsp(cstmtp);
+        addPush(cstmtp, mtaskp);
+    }
+
+    // Create the thread entry point, shared by all threads
+    const string finalName = "__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag;
+    const string name{"__Vthread__" + tag + scheduleName + "__dynamic"};
+    AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+    modp->addStmtsp(funcp);
+    funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+    funcp->isLoose(true);
+    funcp->entryPoint(true);
+    funcp->argTypes("void* voidSelf, bool even_cycle");
+    funcp->addStmtsp(new AstCStmt{fl, EmitCUtil::voidSelfAssign(modp)});
+    funcp->addStmtsp(new AstCStmt{fl, "vlSelf->" + queueName + ".run(voidSelf, even_cycle);"});
+    // Unblock the fake "final" mtask when this thread is finished
+    funcp->addStmtsp(new AstCStmt{fl, "vlSelf->" + finalName + ".signalUpstreamDone(even_cycle);"});
+
+    // No point in using more threads than there are mtasks
+    const size_t nThreads = std::min(schedule.m_threads.size(), mtasks.size());
+    const std::vector<AstCFunc*> funcps(nThreads, funcp);
+
+    // Create the fake "final" mtask state variable
+    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, finalName, s_mtaskStateDtypep};
+    varp->isConst(true);
+    varp->valuep(new AstConst(fl, funcps.size()));
+    varp->protect(false);  // Do not protect as we have references in text
+    modp->addStmtsp(varp);
+
+    V3Stats::addStatSum("Optimizations, Thread schedule dynamic", 1);
+    return funcps;
+}
+
 void addThreadStartWrapper(AstExecGraph* const execGraphp) {
     // FileLine used for constructing nodes below
     FileLine* const fl = v3Global.rootp()->fileline();
@@ -1127,12 +1291,25 @@ void processMTaskBodies(AstExecGraph* const execGraphp) {
     }
 }
 
+bool isDynamicSchedule(const ThreadSchedule& schedule) {
+    if (!v3Global.opt.threadsDynamic()) return false;
+    // Wide (hierarchical) tasks need a fixed set of thread pool workers, keep them static
+    for (const std::vector<const ExecMTask*>& thread : schedule.m_threads) {
+        for (const ExecMTask* const mtaskp : thread) {
+            if (mtaskp->threads() > 1) return false;
+        }
+    }
+    return true;
+}
+
 void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& schedule) {
     // Nothing to be done if there are no MTasks in the graph at all.
     if (execGraphp->depGraphp()->empty()) return;
 
     // Create a function to be run by each thread.
-    const std::vector<AstCFunc*>& funcps = createThreadFunctions(schedule, execGraphp->name());
+    const std::vector<AstCFunc*>& funcps
+        = isDynamicSchedule(schedule) ? createDynamicThreadFunctions(execGraphp, schedule)
+                                      : createThreadFunctions(schedule, execGraphp->name());
     UASSERT(!funcps.empty(), "Non-empty ExecGraph yields no threads?");
 
     // Start the thread functions at the point this AstExecGraph is located in the tree.
@@ -991,6 +991,15 @@ V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
     : V3OutFormatter{lang}
     , m_filename{filename}
     , m_bufferp{new std::array<char, WRITE_BUFFER_SIZE_BYTES>{}} {
+    if (lang == V3OutFormatter::LA_C && v3Global.opt.outputKeepUnchanged()) {
+        // Compare with the existing file, so if identical it keeps its timestamp
+        m_fp = fopen(filename.c_str(), "r");
+        if (m_fp) {
+            V3File::addTgtDepend(filename);
+            m_comparing = true;
+            return;
+        }
+    }
     if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
         v3fatal("Can't write file: " << filename);
     }
@@ -998,11 +1007,38 @@ V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
 
 V3OutFile::~V3OutFile() {
     writeBlock();
+    // Existing file has more contents than the output
+    if (m_comparing && fgetc(m_fp) != EOF) rewriteExisting();
 
     if (m_fp) fclose(m_fp);
     m_fp = nullptr;
 }
 
+void V3OutFile::compareBlock() {
+    std::string existing(m_usedBytes, '\0');
+    const std::size_t got = fread(&existing[0], 1, m_usedBytes, m_fp);
+    if (got == m_usedBytes && std::memcmp(existing.data(), m_bufferp->data(), m_usedBytes) == 0) {
+        return;
+    }
+    rewriteExisting();
+    fwrite(m_bufferp->data(), m_usedBytes, 1, m_fp);
+}
+
+void V3OutFile::rewriteExisting() {
+    // The output differs from the existing file after m_writtenBytes, which matched.
+    // Write the file from scratch, starting with those matching contents.
+    std::string matched(m_writtenBytes, '\0');
+    std::rewind(m_fp);
+    const std::size_t got = fread(&matched[0], 1, m_writtenBytes, m_fp);
+    UASSERT(got == m_writtenBytes, "Compared contents no longer readable: " << m_filename);
+    fclose(m_fp);
+    m_comparing = false;
+    if ((m_fp = fopen(m_filename.c_str(), "w")) == nullptr) {
+        v3fatal("Can't write file: " << m_filename);
+    }
+    fwrite(matched.data(), matched.size(), 1, m_fp);
+}
+
 void V3OutFile::putsForceIncs() {
     const VStringList& forceIncs = v3Global.opt.forceIncs();
     for (const string& i : forceIncs) puts("#include \"" + i + "\"\n");
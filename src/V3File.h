@@ -199,6 +199,9 @@ class V3OutFile VL_NOT_FINAL : public V3OutFormatter {
     std::size_t m_usedBytes = 0;  // Number of bytes stored in m_bufferp
     std::size_t m_writtenBytes = 0;  // Number of bytes written to output
     std::unique_ptr<std::array<char, WRITE_BUFFER_SIZE_BYTES>> m_bufferp;  // Write buffer
+    // --output-keep-unchanged: m_fp is the existing file, read to compare against the output,
+    // which is only written once it differs
+    bool m_comparing = false;
 
 public:
     V3OutFile(const string& filename, V3OutFormatter::Language lang);
@@ -220,7 +223,11 @@ public:
 private:
     void writeBlock() {
         if (VL_LIKELY(m_usedBytes > 0)) {
-            fwrite(m_bufferp->data(), m_usedBytes, 1, m_fp);
+            if (VL_UNLIKELY(m_comparing)) {
+                compareBlock();
+            } else {
+                fwrite(m_bufferp->data(), m_usedBytes, 1, m_fp);
+            }
             m_writtenBytes += m_usedBytes;
             m_usedBytes = 0;
         }
@@ -230,6 +237,8 @@ private:
         m_bufferp->at(m_usedBytes++) = chr;
         if (VL_UNLIKELY(m_usedBytes >= WRITE_BUFFER_SIZE_BYTES)) writeBlock();
     }
+    void compareBlock();
+    void rewriteExisting();
     void putsOutput(const char* str) override {
         std::size_t len = strlen(str);
         std::size_t availableBytes = WRITE_BUFFER_SIZE_BYTES - m_usedBytes;
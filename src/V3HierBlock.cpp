@@ -66,6 +66,8 @@
 // 8) In V3HierBlock.cpp, relationships among hierarchical blocks are checked in run a).
 //    (which block uses other blocks..)
 // 9) In V3EmitMk.cpp, ${prefix}_hier.mk is created in run a).
+//    Blocks are listed in order of the estimated cost of their dependency chain
+//    (critical path), so a parallel make starts the longest chains first.
 //
 // There are three hidden command options:
 //   --hierarchical-child is added to Verilator run b).
@@ -95,6 +97,7 @@
 #include "V3Stats.h"
 #include "V3String.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -311,6 +314,9 @@ class HierBlockUsageCollectVisitor final : public VNVisitorConst {
     AstModule* m_modp = nullptr;  // The current module
     std::vector<AstVar*> m_params;  // Overridden value parameters of current module
     std::vector<AstParamTypeDType*> m_typeParams;  // Type parameters of current module
+    // Estimated Verilation cost of non-hierarchical modules, including their sub-modules
+    std::unordered_map<const AstModule*, uint64_t> m_mod2cost;
+    uint64_t m_cost = 0;  // Estimated Verilation cost of current module
     // Hierarchical blocks instanciated (possibly indirectly) by current hierarchical block
     std::vector<V3HierBlock*> m_childrenp;
 
@@ -323,10 +329,14 @@ class HierBlockUsageCollectVisitor final : public VNVisitorConst {
         UINFO(5, "Visiting " << nodep->prettyNameQ());
         VL_RESTORER(m_modp);
         m_modp = nodep;
+        // Estimate Verilation cost by the size of the tree, sub-modules are added per instance
+        VL_RESTORER(m_cost);
+        m_cost = nodep->nodeCount();
 
         // If not a hierarchical block, just iterate and return
         if (!nodep->hierBlock()) {
             iterateChildrenConst(nodep);
+            m_mod2cost[nodep] = m_cost;
             return;
         }
 
@@ -337,6 +347,7 @@ class HierBlockUsageCollectVisitor final : public VNVisitorConst {
         iterateChildrenConst(nodep);
         // Create the graph vertex for this hier block
         V3HierBlock* const blockp = new V3HierBlock{m_graphp, nodep, m_params, m_typeParams};
+        blockp->cost(m_cost);
         // Record it
         m_mod2vtx[nodep] = blockp;
         // Add an edge to each child block
@@ -349,7 +360,11 @@ class HierBlockUsageCollectVisitor final : public VNVisitorConst {
         // Depth-first traversal of module hierechy
         iterateConst(modp);
         // If this is an instance of a hierarchical block, add to child array to link parent
-        if (modp->hierBlock()) m_childrenp.emplace_back(m_mod2vtx.at(modp));
+        if (modp->hierBlock()) {
+            m_childrenp.emplace_back(m_mod2vtx.at(modp));
+        } else {
+            m_cost += m_mod2cost.at(modp);
+        }
     }
     void visit(AstVar* nodep) override {
         if (!m_modp) return;
@@ -436,6 +451,53 @@ string V3HierGraph::topCommandArgsFilename(bool forMkJson) {
     return V3HierCommandArgsFilename(v3Global.opt.prefix(), forMkJson);
 }
 
+void V3HierGraph::computePathCosts() {
+    // Vertices are topologically sorted, so dependencies are visited before their users
+    uint64_t totalCost = 0;
+    uint64_t criticalCost = 0;
+    for (auto it = vertices().rbegin(); it != vertices().rend(); ++it) {
+        V3HierBlock* const blockp = (*it).as<V3HierBlock>();
+        uint64_t depCost = 0;
+        for (const V3GraphEdge& edge : blockp->outEdges()) {
+            depCost = std::max(depCost, edge.top()->as<V3HierBlock>()->pathCost());
+        }
+        blockp->pathCost(blockp->cost() + depCost);
+        UINFO(5, "Hier block " << blockp->name() << " cost " << blockp->cost() << " path cost "
+                               << blockp->pathCost());
+        totalCost += blockp->cost();
+        criticalCost = std::max(criticalCost, blockp->pathCost());
+    }
+    V3Stats::addStat("HierBlock, Estimated cost, total", totalCost);
+    V3Stats::addStat("HierBlock, Estimated cost, critical path", criticalCost);
+    // Upper bound on speedup of parallel child Verilations over serial ones
+    if (criticalCost) {
+        V3Stats::addStat("HierBlock, Estimated parallelism",
+                         static_cast<double>(totalCost) / criticalCost, 2);
+    }
+}
+
+static std::vector<const V3HierBlock*>
+V3HierSortCriticalPath(std::vector<const V3HierBlock*>&& blockps) {
+    // Stable, so equal costs keep topological order, and output is deterministic
+    std::stable_sort(blockps.begin(), blockps.end(),
+                     [](const V3HierBlock* ap, const V3HierBlock* bp) {
+                         return ap->pathCost() > bp->pathCost();
+                     });
+    return std::move(blockps);
+}
+
+std::vector<const V3HierBlock*> V3HierGraph::criticalPathOrder() const {
+    std::vector<const V3HierBlock*> blockps;
+    for (const V3GraphVertex& vtx : vertices()) blockps.push_back(vtx.as<V3HierBlock>());
+    return V3HierSortCriticalPath(std::move(blockps));
+}
+
+std::vector<const V3HierBlock*> V3HierBlock::dependenciesCriticalPathOrder() const {
+    std::vector<const V3HierBlock*> blockps;
+    for (const V3GraphEdge& edge : outEdges()) blockps.push_back(edge.top()->as<V3HierBlock>());
+    return V3HierSortCriticalPath(std::move(blockps));
+}
+
 void V3HierGraph::writeParametersFiles() const {
     for (const V3GraphVertex& vtx : vertices()) { vtx.as<V3HierBlock>()->writeParametersFile(); }
 }
@@ -460,6 +522,8 @@ void V3Hierarchical::createGraph(AstNetlist* netlistp) {
         VL_DO_DANGLING(delete graphp, graphp);
         return;
     }
+    // Estimate costs to order child Verilations
+    graphp->computePathCosts();
     // Hold on to the graph
     v3Global.hierGraphp(graphp);
 }
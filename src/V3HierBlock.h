@@ -34,6 +34,7 @@ class AstNetlist;
 class AstNodeModule;
 class AstParamTypeDType;
 class AstVar;
+class V3HierBlock;
 
 //######################################################################
 
@@ -48,6 +49,10 @@ public:
     void writeCommandArgsFiles(bool forMkJson) const VL_MT_DISABLED;
     void writeParametersFiles() const VL_MT_DISABLED;
     static string topCommandArgsFilename(bool forMkJson) VL_MT_DISABLED;
+    // Compute path costs, and report estimated Verilation parallelism
+    void computePathCosts() VL_MT_DISABLED;
+    // Blocks with the most expensive dependency chains first
+    std::vector<const V3HierBlock*> criticalPathOrder() const VL_MT_DISABLED;
 };
 
 class V3HierBlock final : public V3GraphVertex {
@@ -64,6 +69,8 @@ class V3HierBlock final : public V3GraphVertex {
     const std::vector<AstVar*> m_params;
     // Types parameters that are overridden by #(.param(value)) syntax.
     const std::vector<AstParamTypeDType*> m_typeParams;
+    uint64_t m_cost = 0;  // Estimated cost of Verilating this block alone
+    uint64_t m_pathCost = 0;  // m_cost plus most expensive chain of dependencies
 
     // METHODS
     static StrGParams stringifyParams(const std::vector<AstVar*>& params,
@@ -82,6 +89,12 @@ public:
     VL_UNMOVABLE(V3HierBlock);
 
     const AstModule* modp() const { return m_modp; }
+    uint64_t cost() const { return m_cost; }
+    void cost(uint64_t value) { m_cost = value; }
+    uint64_t pathCost() const { return m_pathCost; }
+    void pathCost(uint64_t value) { m_pathCost = value; }
+    // Dependencies with the most expensive dependency chains first
+    std::vector<const V3HierBlock*> dependenciesCriticalPathOrder() const VL_MT_DISABLED;
 
     // For emitting Makefile and build definition JSON
     VStringList commandArgs(bool forMkJson) const VL_MT_DISABLED;
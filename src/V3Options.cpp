@@ -1648,6 +1648,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_outputGroups = std::atoi(valp);
         if (m_outputGroups < -1) fl->v3error("--output-groups must be >= -1: " << valp);
     });
+    DECL_OPTION("-output-keep-unchanged", OnOff, &m_outputKeepUnchanged);
     DECL_OPTION("-output-split", Set, &m_outputSplit);
     DECL_OPTION("-output-split-cfuncs", CbVal, [this, fl](const char* valp) {
         m_outputSplitCFuncs = std::atoi(valp);
@@ -1810,6 +1811,17 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                         << fl->warnMore() << "... Suggest 'all', 'none', or 'pure'");
         }
     });
+    DECL_OPTION("-threads-schedule", CbVal, [this, fl](const char* valp) {
+        if (!std::strcmp(valp, "dynamic")) {
+            m_threadsDynamic = true;
+        } else if (!std::strcmp(valp, "static")) {
+            m_threadsDynamic = false;
+        } else {
+            fl->v3error("Unknown setting for --threads-schedule: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'dynamic' or 'static'");
+        }
+    });
     DECL_OPTION("-threads-max-mtasks", CbVal, [this, fl](const char* valp) {
         m_threadsMaxMTasks = std::atoi(valp);
         if (m_threadsMaxMTasks < 1) fl->v3fatal("--threads-max-mtasks must be >= 1: " << valp);
@@ -5354,6 +5354,52 @@ class RandomizeVisitor final : public VNVisitor {
         return false;
     }
 
+    // Whether constraint items only use forms the runtime's in-process solver
+    // handles: scalar rand variables of up to 64 bits under comparisons, logic
+    // and arithmetic.  Must be called before ConstraintExprVisitor.
+    static bool nativeSolvable(const AstNode* itemsp) {
+        for (const AstNode* itemp = itemsp; itemp; itemp = itemp->nextp()) {
+            if (const AstConstraintExpr* const cexprp = VN_CAST(itemp, ConstraintExpr)) {
+                if (cexprp->isDisableSoft() || !nativeSolvableExpr(cexprp->exprp())) return false;
+            } else if (const AstConstraintIf* const cifp = VN_CAST(itemp, ConstraintIf)) {
+                if (!nativeSolvableExpr(cifp->condp()) || !nativeSolvable(cifp->thensp())
+                    || !nativeSolvable(cifp->elsesp()))
+                    return false;
+            } else {
+                return false;  // foreach, unique, solve-before, ...
+            }
+        }
+        return true;
+    }
+    static bool nativeSolvableExpr(const AstNodeExpr* exprp) {
+        if (!exprp->user1()) return true;  // Computable, becomes a constant
+        if (const AstNodeVarRef* const refp = VN_CAST(exprp, NodeVarRef)) {
+            return refp->dtypep()->skipRefp()->isIntegralOrPacked()
+                   && refp->width() <= VL_QUADSIZE && !refp->varp()->isRandC();
+        }
+        if (const AstSel* const selp = VN_CAST(exprp, Sel)) {
+            return VN_IS(selp->lsbp(), Const) && nativeSolvableExpr(selp->fromp());
+        }
+        if (!(VN_IS(exprp, Const) || VN_IS(exprp, Eq) || VN_IS(exprp, Neq) || VN_IS(exprp, Lt)
+              || VN_IS(exprp, Lte) || VN_IS(exprp, Gt) || VN_IS(exprp, Gte) || VN_IS(exprp, LtS)
+              || VN_IS(exprp, LteS) || VN_IS(exprp, GtS) || VN_IS(exprp, GteS)
+              || VN_IS(exprp, LogAnd) || VN_IS(exprp, LogOr) || VN_IS(exprp, LogNot)
+              || VN_IS(exprp, LogIf) || VN_IS(exprp, LogEq) || VN_IS(exprp, And)
+              || VN_IS(exprp, Or) || VN_IS(exprp, Xor) || VN_IS(exprp, Not)
+              || VN_IS(exprp, Negate) || VN_IS(exprp, Add) || VN_IS(exprp, Sub)
+              || VN_IS(exprp, Mul) || VN_IS(exprp, Div) || VN_IS(exprp, DivS)
+              || VN_IS(exprp, ModDiv) || VN_IS(exprp, ModDivS) || VN_IS(exprp, ShiftL)
+              || VN_IS(exprp, ShiftR) || VN_IS(exprp, ShiftRS) || VN_IS(exprp, Extend)
+              || VN_IS(exprp, ExtendS) || VN_IS(exprp, Concat) || VN_IS(exprp, Cond))) {
+            return false;
+        }
+        if (exprp->width() > VL_QUADSIZE) return false;
+        for (const AstNode* const opp : {exprp->op1p(), exprp->op2p(), exprp->op3p()}) {
+            if (opp && !nativeSolvableExpr(VN_AS(opp, NodeExpr))) return false;
+        }
+        return true;
+    }
+
     // VISITORS
     void visit(AstNodeModule* nodep) override {
         VL_RESTORER(m_modp);
@@ -5403,6 +5449,11 @@ class RandomizeVisitor final : public VNVisitor {
         AstNodeExpr* beginValp = nullptr;
         AstVar* genp = getRandomGenerator(nodep);
         if (genp) {
+            // Whether every constraint suits the runtime's in-process solver
+            bool nativeSolve = true;
+            nodep->foreachMember([&](AstClass* const, AstVar* const varp) {
+                if (varp->isRandC()) nativeSolve = false;
+            });
             // Phase 1: Process all constraints (create tasks, run ConstraintExprVisitor)
             // Setup task refs are NOT added to setupAllTaskp here -- done in phase 2
             nodep->foreachMember([&](AstClass* const classp, AstConstraint* const constrp) {
@@ -5424,6 +5475,7 @@ class RandomizeVisitor final : public VNVisitor {
                 if (constrp->itemsp()) {
                     lowerDistConstraints(taskp, constrp->itemsp(), randModeVarp);
                 }
+                if (!nativeSolvable(constrp->itemsp())) nativeSolve = false;
                 std::set<AstVar*>& sizeArrays = m_sizeConstrainedArrays[classp];
                 ConstraintExprVisitor{classp,        m_memberMap, constrp->itemsp(),
                                       nullptr,       genp,        randModeVarp,
@@ -5493,6 +5545,15 @@ class RandomizeVisitor final : public VNVisitor {
                 }
             }
             randomizep->addStmtsp(implementConstraintsClear(fl, genp));
+            if (nativeSolve) {
+                AstCMethodHard* const nativep = new AstCMethodHard{
+                    fl,
+                    new AstVarRef{fl, VN_AS(genp->user2p(), NodeModule), genp,
+                                  VAccess::READWRITE},
+                    VCMethod::RANDOMIZER_NATIVE_SOLVE, new AstConst{fl, AstConst::BitTrue{}}};
+                nativep->dtypeSetVoid();
+                randomizep->addStmtsp(nativep->makeStmt());
+            }
 
             // Restrict enum variables in solver to valid members only
             {
@@ -117,6 +117,7 @@ public:
     static constexpr const char* STAT_WALLTIME_BUILD = "Wall time, Build (sec)";
     static constexpr const char* STAT_WALLTIME_CVT = "Wall time, Conversion (sec)";
     static constexpr const char* STAT_WALLTIME_ELAB = "Wall time, Elaboration (sec)";
+    static constexpr const char* STAT_WALLTIME_HIER = "Wall time, Hierarchical (sec)";
 
     static void addStat(const V3Statistic&);
     static void addStat(const string& stage, const string& name, double value,
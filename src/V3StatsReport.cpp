@@ -204,6 +204,8 @@ double V3Stats::getStatSum(const string& name) { return StatsReport::getStatSum(
 
 void V3Stats::statsStage(const string& name) {
     static double s_lastWallTime = -1;
+    static const VlOs::DeltaCpuTime s_cpuTimer{true};
+    static double s_lastCpuTime = 0;
     static int s_fileNumber = 0;
 
     const string digitName = V3Global::digitsFilename(++s_fileNumber) + "_" + name;
@@ -215,6 +217,14 @@ void V3Stats::statsStage(const string& name) {
     V3Stats::addStatPerf("Stage, Elapsed time (sec), " + digitName, wallTimeDelta);
     V3Stats::addStatPerf("Stage, Elapsed time (sec), TOTAL", wallTimeDelta);
 
+    // CPU time is summed over all threads, so exceeds elapsed time in stages using
+    // --verilate-jobs, and shows which stages are still single threaded
+    const double cpuTime = s_cpuTimer.deltaTime();
+    const double cpuTimeDelta = cpuTime - s_lastCpuTime;
+    s_lastCpuTime = cpuTime;
+    V3Stats::addStatPerf("Stage, CPU time (sec), " + digitName, cpuTimeDelta);
+    V3Stats::addStatPerf("Stage, CPU time (sec), TOTAL", cpuTimeDelta);
+
     uint64_t memPeak;
     uint64_t memCurrent;
     VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
@@ -270,11 +280,13 @@ void V3Stats::summaryReport() {
     const double walltimeElab = V3Stats::getStatSum(STAT_WALLTIME_ELAB);
     const double walltimeCvt = V3Stats::getStatSum(STAT_WALLTIME_CVT);
     const double walltimeBuild = V3Stats::getStatSum(STAT_WALLTIME_BUILD);
+    const double walltimeHier = V3Stats::getStatSum(STAT_WALLTIME_HIER);
     const double cputime = V3Stats::getStatSum(STAT_CPUTIME);
     std::cout << "- Verilator: Walltime " << walltime << " s (elab=" << walltimeElab
-              << ", cvt=" << walltimeCvt << ", bld=" << walltimeBuild << "); cpu " << cputime
-              << " s on " << std::max(v3Global.opt.verilateJobs(), v3Global.opt.buildJobs())
-              << " threads";
+              << ", cvt=" << walltimeCvt << ", bld=" << walltimeBuild;
+    if (walltimeHier != 0.0) std::cout << ", hier=" << walltimeHier;
+    std::cout << "); cpu " << cputime << " s on "
+              << std::max(v3Global.opt.verilateJobs(), v3Global.opt.buildJobs()) << " threads";
     uint64_t memPeak;
     uint64_t memCurrent;
     VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
@@ -869,11 +869,14 @@ static void execBuildJob() {
 
 static void execHierVerilation() {
     UASSERT(v3Global.hierGraphp(), "must be called only when plan exists");
+    // Compare with the 'HierBlock, Estimated' statistics to see the achieved parallelism
+    const VlOs::DeltaWallTime hierWallTime{true};
     const string makefile = v3Global.opt.prefix() + "_hier.mk ";
     const string target = v3Global.opt.build() ? " hier_build" : " hier_verilation";
     const string cmdStr = buildMakeCmd(makefile, target);
     V3Os::filesystemFlushBuildDir(v3Global.opt.hierTopDataDir());
     const int exit_code = V3Os::system(cmdStr);
+    V3Stats::addStatPerf(V3Stats::STAT_WALLTIME_HIER, hierWallTime.deltaTime());
     if (exit_code != 0) {
         v3error(cmdStr << " exited with " << exit_code << std::endl);
         v3Global.vlExit(exit_code);
@@ -45,12 +45,18 @@ static int debug() { return V3Error::debugDefault(); }
 
 #include <algorithm>
 #include <fstream>
+#include <thread>
 
 //######################################################################
 // VlcOptions
 
 void VlcOptions::addReadFile(const string& filename) { m_readFiles.insert(filename); }
 
+unsigned VlcOptions::threads() const {
+    if (m_threads > 0) return m_threads;
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
 string VlcOptions::version() {
     string ver = PACKAGE_STRING;
     ver += " rev " + cvtToStr(DTVERSION_rev);
@@ -91,6 +97,7 @@ void VlcOptions::parseOptsList(int argc, char** argv) {
     DECL_OPTION("-levels", Set, &m_reportLevels);
     DECL_OPTION("-rank", OnOff, &m_rank);
     DECL_OPTION("-report", Set, &m_report);
+    DECL_OPTION("-threads", Set, &m_threads);
     DECL_OPTION("-unlink", OnOff, &m_unlink);
     DECL_OPTION("-V", CbCall, []() {
         showVersion(true);
@@ -101,6 +108,7 @@ void VlcOptions::parseOptsList(int argc, char** argv) {
         std::exit(0);
     });
     DECL_OPTION("-write", Set, &m_writeFile);
+    DECL_OPTION("-write-binary", Set, &m_writeBinaryFile);
     DECL_OPTION("-write-info", Set, &m_writeInfoFile);
     parser.finalize();
 
@@ -152,18 +160,16 @@ int main(int argc, char** argv) {
 
     if (top.opt.readFiles().empty()) top.opt.addReadFile("vlt_coverage.dat");
 
-    {
-        const VlStringSet& readFiles = top.opt.readFiles();
-        for (const auto& filename : readFiles) top.readCoverage(filename);
-    }
+    top.readCoverages(top.opt.readFiles());
 
     if (debug() >= 9) {
         top.tests().dump(true);
         top.points().dump();
     }
 
-    const bool defaultReport = !top.opt.reportSpecified() && !top.opt.rank()
-                               && top.opt.writeFile().empty() && top.opt.writeInfoFile().empty();
+    const bool writing = !top.opt.writeFile().empty() || !top.opt.writeBinaryFile().empty()
+                         || !top.opt.writeInfoFile().empty();
+    const bool defaultReport = !top.opt.reportSpecified() && !top.opt.rank() && !writing;
     if (top.opt.reportSpecified()) {
         if (top.opt.reportSummary()) top.printTypeSummary();
         if (top.opt.reportHierarchy()) top.printHierarchyReport();
@@ -179,8 +185,11 @@ int main(int argc, char** argv) {
         top.tests().dump(false);
     }
 
-    if (!top.opt.writeFile().empty() || !top.opt.writeInfoFile().empty()) {
+    if (writing) {
         if (!top.opt.writeFile().empty()) top.writeCoverage(top.opt.writeFile());
+        if (!top.opt.writeBinaryFile().empty()) {
+            top.writeCoverageBinary(top.opt.writeBinaryFile());
+        }
         if (!top.opt.writeInfoFile().empty()) top.writeInfo(top.opt.writeInfoFile());
         V3Error::abortIfWarnings();
         if (top.opt.unlink()) {
@@ -47,8 +47,10 @@ class VlcOptions final {
     bool m_reportSummary = false;  // main switch: --report summary
     bool m_reportHierarchy = false;  // main switch: --report hier or hierarchy
     bool m_rank = false;        // main switch: --rank
+    int m_threads = 0;          // main switch: --threads, 0 means all cores
     bool m_unlink = false;      // main switch: --unlink
     string m_writeFile;         // main switch: --write
+    string m_writeBinaryFile;   // main switch: --write-binary
     string m_writeInfoFile;     // main switch: --write-info
     // clang-format on
 
@@ -79,10 +81,13 @@ public:
     bool reportSummary() const { return m_reportSummary; }
     bool reportHierarchy() const { return m_reportHierarchy; }
     bool rank() const { return m_rank; }
+    unsigned threads() const VL_MT_DISABLED;
     bool unlink() const { return m_unlink; }
     string writeFile() const { return m_writeFile; }
+    string writeBinaryFile() const { return m_writeBinaryFile; }
     string writeInfoFile() const { return m_writeInfoFile; }
     bool isTypeMatch(const char* name) const {
+        if (m_filterType == "*") return true;  // Fast path, as every type matches
         return VString::wildmatch(VlcPoint::typeExtract(name), m_filterType);
     }
 
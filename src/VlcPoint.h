@@ -20,6 +20,8 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <algorithm>
+#include <array>
 #include <iomanip>
 #include <map>
 #include <unordered_map>
@@ -152,20 +154,41 @@ public:
 // VlcPoints - Container of all points
 
 class VlcPoints final {
+public:
+    // TYPES
+    // Number of name lookup shards, so merging can look up names in parallel
+    static constexpr size_t SHARDS = 64;
+    using NameMap = std::unordered_map<std::string, uint64_t>;  // Name to point-number
+    using ByName = std::vector<std::pair<const std::string*, uint64_t>>;  // Sorted by name
+
+private:
     // MEMBERS
-    using NameMap = std::map<const std::string, uint64_t>;  // Sorted by name (ordered)
-    NameMap m_nameMap;  //< Name to point-number
+    std::array<NameMap, SHARDS> m_nameMaps;  //< Name to point-number, sharded by name hash
     std::vector<VlcPoint> m_points;  //< List of all points
-    uint64_t m_numPoints = 0;  //< Total unique points
+    ByName m_byName;  //< All names sorted, rebuilt when points are added
 
     static int debug() { return V3Error::debugDefault(); }
 
+    ByName& byName() {
+        if (m_byName.size() != m_points.size()) {
+            m_byName.clear();
+            m_byName.reserve(m_points.size());
+            for (const NameMap& nameMap : m_nameMaps) {
+                for (const auto& it : nameMap) m_byName.emplace_back(&it.first, it.second);
+            }
+            std::sort(m_byName.begin(), m_byName.end(),
+                      [](const ByName::value_type& a, const ByName::value_type& b) {
+                          return *a.first < *b.first;
+                      });
+        }
+        return m_byName;
+    }
+
 public:
     // ITERATORS
-    using ByName = NameMap;
     using iterator = ByName::iterator;
-    ByName::iterator begin() { return m_nameMap.begin(); }
-    ByName::iterator end() { return m_nameMap.end(); }
+    ByName::iterator begin() { return byName().begin(); }
+    ByName::iterator end() { return byName().end(); }
 
     // CONSTRUCTORS
     VlcPoints() = default;
@@ -181,9 +204,18 @@ public:
         }
     }
     VlcPoint& pointNumber(uint64_t num) { return m_points[num]; }
+    static size_t shardOf(const string& name) { return std::hash<string>{}(name) % SHARDS; }
+    NameMap& nameMap(size_t shard) { return m_nameMaps[shard]; }
+    // Make a point for a name just entered in its shard's name map
+    void newPoint(NameMap::value_type& entry) {
+        entry.second = m_points.size();
+        m_points.emplace_back(entry.first, entry.second);
+    }
+    void reserve(size_t count) { m_points.reserve(count); }
+    size_t size() const { return m_points.size(); }
     uint64_t findAddPoint(const string& name, uint64_t count) {
-        const auto pair = m_nameMap.emplace(name, m_numPoints);
-        if (pair.second) m_points.emplace_back(name, m_numPoints++);
+        const auto pair = nameMap(shardOf(name)).emplace(name, 0);
+        if (pair.second) newPoint(*pair.first);
         const uint64_t pointnum = pair.first->second;
         m_points[pointnum].countInc(count);
         return pointnum;
@@ -24,12 +24,16 @@
 #include "VlcOptions.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <map>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 //######################################################################
@@ -165,41 +169,214 @@ void printTypeTally(const TypeTally& tally, size_t indent, bool includeMissingOr
     }
 }
 
-}  // namespace
+// A coverage file as read by a worker thread, before merging
+struct VlcReadFile final {
+    struct Entry final {
+        size_t m_nameOffset;  // Point name position in m_names
+        size_t m_nameSize;  // Point name length
+        uint64_t m_hits;  // Point count in this file
+        const uint64_t* m_pointnump;  // Point number, once looked up
+    };
+    string m_filename;  // Filename
+    bool m_opened = false;  // File could be read
+    string m_error;  // Non-empty if the file is malformed
+    string m_names;  // All point names, concatenated to avoid an allocation per point
+    std::vector<Entry> m_entries;  // Points, in file order
+    // Indices into m_entries of each name lookup shard's points
+    std::array<std::vector<uint32_t>, VlcPoints::SHARDS> m_shardEntries;
+
+    void addEntry(const string& name, uint64_t hits) {
+        m_shardEntries[VlcPoints::shardOf(name)].push_back(m_entries.size());
+        m_entries.push_back({m_names.size(), name.size(), hits, nullptr});
+        m_names += name;
+    }
+    void entryName(const Entry& entry, string& namer) const {
+        namer.assign(m_names, entry.m_nameOffset, entry.m_nameSize);
+    }
+};
 
-void VlcTop::readCoverage(const string& filename, bool nonfatal) {
-    UINFO(2, "readCoverage " << filename);
+// Call func(0..count-1), spread over up to the given number of threads
+template <typename T_Func>
+void parallelFor(unsigned threads, size_t count, T_Func func) {
+    if (threads > count) threads = count;
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i) func(i);
+        return;
+    }
+    std::atomic<size_t> next{0};
+    const auto work = [&]() {
+        for (size_t i; (i = next++) < count;) func(i);
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(work);
+    work();
+    for (std::thread& worker : workers) worker.join();
+}
+
+void parseText(VlcReadFile& file, const string& data, const VlcOptions& opt) {
+    const char* const datap = data.c_str();
+    const char* const endp = datap + data.size();
+    string point;
+    for (const char* linep = datap; linep < endp;) {
+        const char* eolp = static_cast<const char*>(std::memchr(linep, '\n', endp - linep));
+        if (!eolp) eolp = endp;
+        const size_t len = eolp - linep;
+        if (linep[0] == 'C' && len >= 3) {
+            size_t secspace = 3;
+            for (; secspace + 1 < len; secspace++) {
+                if (linep[secspace] == '\'' && linep[secspace + 1] == ' ') break;
+            }
+            if (secspace + 1 >= len) secspace = len;
+            point.assign(linep + 3, secspace - 3);
+            if (opt.isTypeMatch(point.c_str())) {
+                const uint64_t hits = secspace < len ? std::atoll(linep + secspace + 1) : 0;
+                file.addEntry(point, hits);
+            }
+        }
+        linep = eolp + 1;
+    }
+}
+
+void parseBinary(VlcReadFile& file, const string& data, const VlcOptions& opt) {
+    const char* cp = data.c_str() + VerilatedCovBinary::magicSize();
+    const char* const endp = data.c_str() + data.size();
+    VerilatedCovBinaryReader reader;
+    string point;
+    while (cp < endp) {
+        uint64_t hits;
+        cp = reader.getPoint(cp, endp, point, hits);
+        if (!cp) {
+            file.m_error = "Corrupt binary coverage file: " + file.m_filename;
+            return;
+        }
+        if (opt.isTypeMatch(point.c_str())) file.addEntry(point, hits);
+    }
+}
 
-    std::ifstream is{filename.c_str()};
-    if (!is) {
-        if (!nonfatal) v3fatal("Can't read coverage file: " << filename);
+// Read and parse one file; runs in a worker thread, so must not report errors
+void readFile(VlcReadFile& file, const VlcOptions& opt) {
+    std::ifstream is{file.m_filename.c_str(), std::ios::binary};
+    if (!is) return;
+    string data;
+    is.seekg(0, std::ios::end);
+    const std::streamoff size = is.tellg();
+    if (size >= 0) {
+        data.resize(static_cast<size_t>(size));
+        is.seekg(0);
+        is.read(&data[0], data.size());
+        data.resize(static_cast<size_t>(is.gcount()));
+    } else {  // Not seekable, e.g. a fifo, so read until end of file
+        is.clear();
+        std::ostringstream os;
+        os << is.rdbuf();
+        data = os.str();
+    }
+    file.m_opened = true;
+    if (is.bad()) {
+        file.m_error = "Error reading coverage file: " + file.m_filename;
         return;
     }
+    file.m_names.reserve(data.size());
+    if (data.compare(0, VerilatedCovBinary::magicSize(), VerilatedCovBinary::magic()) == 0) {
+        parseBinary(file, data, opt);
+    } else if (data.compare(0, VerilatedCovBinary::magicPrefixSize(),
+                            VerilatedCovBinary::magicPrefix())
+               == 0) {
+        file.m_error = "Unsupported binary coverage file version: " + file.m_filename;
+    } else {
+        parseText(file, data, opt);
+    }
+}
+
+}  // namespace
 
-    // Testrun and computrons argument unsupported as yet
-    VlcTest* const testp = tests().newTest(filename, 0, 0);
+void VlcTop::readCoverage(const string& filename, bool nonfatal) {
+    readCoverages(VlStringSet{filename}, nonfatal);
+}
+
+void VlcTop::readCoverages(const VlStringSet& filenames, bool nonfatal) {
+    // Files are read in batches, so memory is bounded however many files there
+    // are.  Each batch is parsed one file per thread, then merged one name
+    // lookup shard per thread.  Points are numbered as if the files were read
+    // in order, so the result does not depend on the number of threads.
+    const unsigned threads = opt.threads();
+    const size_t batchSize = 8 * threads;
+    const std::vector<string> allFilenames{filenames.begin(), filenames.end()};
+    for (size_t batchStart = 0; batchStart < allFilenames.size(); batchStart += batchSize) {
+        std::vector<VlcReadFile> files(std::min(batchSize, allFilenames.size() - batchStart));
+        for (size_t i = 0; i < files.size(); ++i) {
+            files[i].m_filename = allFilenames[batchStart + i];
+            UINFO(2, "readCoverage " << files[i].m_filename);
+        }
+        parallelFor(threads, files.size(), [&](size_t i) { readFile(files[i], opt); });
 
-    while (!is.eof()) {
-        const string line = V3Os::getline(is);
-        // UINFO(9, " got " << line);
-        if (line[0] == 'C') {
-            string::size_type secspace = 3;
-            for (; secspace < line.length(); secspace++) {
-                if (line[secspace] == '\'' && line[secspace + 1] == ' ') break;
+        std::vector<VlcTest*> testps(files.size(), nullptr);
+        for (size_t i = 0; i < files.size(); ++i) {
+            if (!files[i].m_opened) {
+                if (!nonfatal) v3fatal("Can't read coverage file: " << files[i].m_filename);
+                continue;
             }
-            const string point = line.substr(3, secspace - 3);
-            if (!opt.isTypeMatch(point.c_str())) continue;
+            if (!files[i].m_error.empty()) v3fatal(files[i].m_error);
+            // Testrun and computrons argument unsupported as yet
+            testps[i] = tests().newTest(files[i].m_filename, 0, 0);
+        }
 
-            const uint64_t hits = std::atoll(line.c_str() + secspace + 1);
-            // UINFO(9, "   point '" << point << "'" << " " << hits);
+        // Look up each name in its shard, collecting names new to this batch
+        struct NewPoint final {
+            size_t m_file;  // Index of file first containing the name
+            uint32_t m_entry;  // Index of entry in that file
+            VlcPoints::NameMap::value_type* m_namep;  // Entry in the name map
+        };
+        std::array<std::vector<NewPoint>, VlcPoints::SHARDS> newPoints;
+        parallelFor(threads, VlcPoints::SHARDS, [&](size_t shard) {
+            VlcPoints::NameMap& nameMap = points().nameMap(shard);
+            string name;
+            for (size_t f = 0; f < files.size(); ++f) {
+                for (const uint32_t e : files[f].m_shardEntries[shard]) {
+                    VlcReadFile::Entry& entry = files[f].m_entries[e];
+                    files[f].entryName(entry, name);
+                    auto it = nameMap.find(name);
+                    if (it == nameMap.end()) {
+                        it = nameMap.emplace(name, 0).first;
+                        newPoints[shard].push_back({f, e, &*it});
+                    }
+                    entry.m_pointnump = &it->second;
+                }
+            }
+        });
 
-            const uint64_t pointnum = points().findAddPoint(point, hits);
-            if (opt.rank()) {  // Only if ranking - uses a lot of memory
-                if (hits >= VlcBuckets::sufficient()) {
-                    points().pointNumber(pointnum).testsCoveringInc();
-                    testp->buckets().addData(pointnum, hits);
+        // Number the new points in file order
+        std::vector<NewPoint> ordered;
+        for (std::vector<NewPoint>& shardPoints : newPoints) {
+            ordered.insert(ordered.end(), shardPoints.begin(), shardPoints.end());
+        }
+        std::sort(ordered.begin(), ordered.end(), [](const NewPoint& a, const NewPoint& b) {
+            return a.m_file != b.m_file ? a.m_file < b.m_file : a.m_entry < b.m_entry;
+        });
+        points().reserve(points().size() + ordered.size());
+        for (const NewPoint& newPoint : ordered) points().newPoint(*newPoint.m_namep);
+
+        // Each shard owns its points, so can count them without locking
+        parallelFor(threads, VlcPoints::SHARDS, [&](size_t shard) {
+            for (const VlcReadFile& file : files) {
+                for (const uint32_t e : file.m_shardEntries[shard]) {
+                    const VlcReadFile::Entry& entry = file.m_entries[e];
+                    VlcPoint& point = points().pointNumber(*entry.m_pointnump);
+                    point.countInc(entry.m_hits);
+                    if (opt.rank() && entry.m_hits >= VlcBuckets::sufficient()) {
+                        point.testsCoveringInc();
+                    }
                 }
             }
+        });
+        if (opt.rank()) {  // Only if ranking - uses a lot of memory
+            parallelFor(threads, files.size(), [&](size_t f) {
+                for (const VlcReadFile::Entry& entry : files[f].m_entries) {
+                    if (entry.m_hits >= VlcBuckets::sufficient()) {
+                        testps[f]->buckets().addData(*entry.m_pointnump, entry.m_hits);
+                    }
+                }
+            });
         }
     }
 }
@@ -220,6 +397,27 @@ void VlcTop::writeCoverage(const string& filename) {
     }
 }
 
+void VlcTop::writeCoverageBinary(const string& filename) {
+    UINFO(2, "writeCoverageBinary " << filename);
+
+    std::ofstream os{filename.c_str(), std::ios::binary};
+    if (!os) {
+        v3fatal("Can't write file: " << filename);
+        return;
+    }
+
+    VerilatedCovBinaryWriter writer;
+    for (const auto& i : m_points) {
+        const VlcPoint& point = m_points.pointNumber(i.second);
+        writer.putPoint(point.name(), point.count());
+        if (writer.buf().size() >= 64 * 1024) {
+            os.write(writer.buf().data(), writer.buf().size());
+            writer.buf().clear();
+        }
+    }
+    os.write(writer.buf().data(), writer.buf().size());
+}
+
 void VlcTop::writeInfo(const string& filename) {
     UINFO(2, "writeInfo " << filename);
 
@@ -58,7 +58,9 @@ public:
     void printHierarchyReport();
     void printTypeSummary();
     void readCoverage(const string& filename, bool nonfatal = false);
+    void readCoverages(const VlStringSet& filenames, bool nonfatal = false);
     void writeCoverage(const string& filename);
+    void writeCoverageBinary(const string& filename);
     void writeInfo(const string& filename);
 
     void rank();
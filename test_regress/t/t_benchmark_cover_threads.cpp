@@ -0,0 +1,52 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: Multithreaded coverage counter benchmark
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+#ifndef TEST_CYCLES
+#define TEST_CYCLES 200000  // Clock edges; the .py passes fewer unless benchmarking
+#endif
+
+// Measure multithreaded simulation throughput; run with and without
+// --coverage to see the cost of counting coverage from several threads.
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    constexpr int CYCLES = TEST_CYCLES;
+    const auto start = std::chrono::steady_clock::now();
+    topp->clk = 0;
+    for (int cyc = 0; cyc < CYCLES; ++cyc) {
+        topp->clk = !topp->clk;
+        topp->eval();
+        contextp->timeInc(1);
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    printf("threads %u coverage %s: %.0f cycles/s\n", contextp->threads(),
+           VM_COVERAGE ? "on" : "off", CYCLES / elapsed.count());
+    topp->final();
+#if VM_COVERAGE
+    contextp->coveragep()->write(VL_STRINGIFY(TEST_OBJ_DIR) "/coverage.dat");
+#endif
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+# Clock edges; enough for the 5000 counted posedges when not benchmarking
+test.cycles = (200000 if test.benchmark else 12000)
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=[
+                 "--coverage", "--exe", test.pli_filename, test.wno_unopthreads_for_few_cores,
+                 "-CFLAGS", "-DTEST_CYCLES=" + str(test.cycles)
+             ],
+             threads=4)
+
+test.execute()
+
+if test.benchmark:
+    test.file_grep(test.run_log_filename, r'threads 4 coverage on: [0-9]+ cycles/s')
+# Counts summed over the per-thread shards
+test.file_grep(test.obj_dir + "/coverage.dat", r"' 5000$")
+
+test.passes()
@@ -0,0 +1,63 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  // Independent lanes, so the model partitions them across threads, each
+  // updating its own coverage counters every cycle
+  localparam LANES = 16;
+
+  integer cyc = 0;
+  integer hits = 0;
+  wire [31:0] state[LANES];
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc < 5000) begin
+      hits <= hits + 1;  // Hit exactly 5000 times, whatever the cycle count
+    end
+  end
+
+  for (genvar g = 0; g < LANES; ++g) begin : gen_lane
+    lane #(.SEED(g + 1)) u_lane (
+        .clk(clk),
+        .state(state[g])
+    );
+  end
+
+endmodule
+
+module lane #(
+    parameter SEED = 1
+) (
+    input clk,
+    output reg [31:0] state
+);
+
+  reg [31:0] acc;
+
+  initial begin
+    state = SEED;
+    acc = '0;
+  end
+
+  always @(posedge clk) begin
+    state <= {state[30:0], state[31] ^ state[21] ^ state[1] ^ state[0]};
+    case (state[2:0])
+      3'd0: acc <= acc + state;
+      3'd1: acc <= acc ^ state;
+      3'd2: acc <= acc - state;
+      3'd3: acc <= {acc[15:0], acc[31:16]};
+      3'd4: acc <= acc | state;
+      3'd5: acc <= acc & ~state;
+      3'd6: acc <= acc + 32'd1;
+      default: acc <= ~acc;
+    endcase
+  end
+
+endmodule
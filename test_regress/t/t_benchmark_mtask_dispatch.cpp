@@ -0,0 +1,74 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: Thread pool mtask dispatch latency benchmark
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include VM_PREFIX_INCLUDE
+
+#include "verilated_threads.h"
+
+#include <chrono>
+#include <memory>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static constexpr int ITERATIONS = 200000;
+static constexpr int BURST = 64;
+
+static void incrementTask(void* userp, bool) {
+    std::atomic<uint64_t>* const countp = static_cast<std::atomic<uint64_t>*>(userp);
+    countp->fetch_add(1, std::memory_order_relaxed);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    contextp->threads(2);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    VlThreadPool* const poolp = static_cast<VlThreadPool*>(contextp->threadPoolp());
+    TEST_CHECK_EQ(poolp->numThreads(), 1);
+    VlWorkerThread* const workerp = poolp->workerp(0);
+    std::atomic<uint64_t> count{0};
+
+    // Round trip: hand one task to the worker and wait for it to complete,
+    // as the eval thread does for each mtask it waits on
+    const auto roundStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        workerp->addTask(incrementTask, &count);
+        const uint64_t expected = i + 1;
+        while (count.load(std::memory_order_relaxed) != expected) VL_CPU_RELAX();
+    }
+    const auto roundEnd = std::chrono::steady_clock::now();
+    TEST_CHECK_EQ(count.load(), static_cast<uint64_t>(ITERATIONS));
+
+    // Throughput: enqueue bursts of tasks without waiting in between
+    count = 0;
+    const auto burstStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS / BURST; ++i) {
+        for (int j = 0; j < BURST; ++j) workerp->addTask(incrementTask, &count);
+        workerp->wait();
+    }
+    const auto burstEnd = std::chrono::steady_clock::now();
+    TEST_CHECK_EQ(count.load(), static_cast<uint64_t>(ITERATIONS / BURST * BURST));
+
+    const double roundNs
+        = std::chrono::duration<double, std::nano>(roundEnd - roundStart).count() / ITERATIONS;
+    const double burstNs
+        = std::chrono::duration<double, std::nano>(burstEnd - burstStart).count() / ITERATIONS;
+    VL_PRINTF("mtask dispatch round trip: %.1f ns\n", roundNs);
+    VL_PRINTF("mtask dispatch burst: %.1f ns/task\n", burstNs);
+
+    topp->final();
+    return errors ? 10 : 0;
+}
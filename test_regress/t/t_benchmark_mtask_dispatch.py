@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_threads_counter.v"
+
+if not test.benchmark:
+    test.skip("Benchmark only, run with --benchmark")
+
+# Spinning hand-off needs the worker and main thread on separate cores
+test.skip_if_too_few_cores()
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe", test.pli_filename],
+             threads=2)
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'mtask dispatch round trip: [0-9.]+ ns')
+
+test.passes()
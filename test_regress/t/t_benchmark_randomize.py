@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+if not test.benchmark:
+    test.skip("Benchmark only, run with --benchmark")
+
+if not test.have_solver:
+    test.skip("No constraint solver installed")
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe", test.pli_filename])
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'randomize: [0-9]+ calls/s')
+
+test.passes()
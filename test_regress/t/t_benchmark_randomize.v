@@ -0,0 +1,36 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+class Item;
+  rand bit [31:0] addr;
+  rand bit [7:0] len;
+  rand bit [3:0] kind;
+
+  constraint c_addr {addr[1:0] == 2'b00; addr < 32'h1000_0000;}
+  constraint c_len {len inside {[1 : 64]};}
+  constraint c_kind {kind != 4'hf; (kind == 0) -> len == 1;}
+  constraint c_soft {soft len < 16;}
+endclass
+
+module t;
+
+  // Must match CALLS in the driver
+  localparam int CALLS = 2000;
+
+  Item item;
+
+  initial begin
+    item = new;
+    for (int i = 0; i < CALLS; ++i) begin
+      if (item.randomize() != 1) $stop;
+      if (item.addr[1:0] != 0 || item.addr >= 32'h1000_0000) $stop;
+      if (item.len < 1 || item.len > 64) $stop;
+      if (item.kind == 4'hf || (item.kind == 0 && item.len != 1)) $stop;
+    end
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
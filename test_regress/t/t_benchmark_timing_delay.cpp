@@ -0,0 +1,42 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: Delay scheduler suspend/resume throughput benchmark
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    const auto start = std::chrono::steady_clock::now();
+    uint64_t slots = 0;
+    while (!contextp->gotFinish()) {
+        topp->eval();
+        ++slots;
+        if (!topp->eventsPending()) break;
+        contextp->time(topp->nextTimeSlot());
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // The model reports the number of resumed delays, together this gives the throughput
+    printf("delay time slots: %" PRIu64 " in %.3f s\n", slots, elapsed.count());
+
+    topp->final();
+    return 0;
+}
@@ -0,0 +1,49 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+// verilog_format: on
+
+module t;
+  timeunit 1ns; timeprecision 100ps;
+
+  // Many concurrent processes with short, mixed delays, plus far-future
+  // timeouts, to stress the delay scheduler
+  localparam int N = 4096;
+  localparam int END_TIME = 5000;
+
+  int unsigned resumes[N];
+
+  for (genvar i = 0; i < N; ++i) begin : g_proc
+    initial forever begin
+      #(1 + i % 97);
+      resumes[i]++;
+    end
+    initial #(1000000 + i) $stop;  // Timeout, never reached
+  end
+
+  initial #(64'd1 << 40) $stop;  // Far-future timeout, never reached
+
+  initial begin
+    int unsigned total;
+    int unsigned expected;
+    // Half a unit after END_TIME, so resumes at END_TIME itself are counted
+    #(END_TIME + 0.5);
+    total = 0;
+    expected = 0;
+    for (int i = 0; i < N; ++i) begin
+      total += resumes[i];
+      expected += END_TIME / (1 + i % 97);
+    end
+    $display("delay resumes: %0d", total);
+    `checkd(total, expected);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+
+endmodule
@@ -0,0 +1,58 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: FST tracing throughput benchmark
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+#include <verilated_fst_c.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+// Measure simulation throughput with FST tracing on, flushing often so many
+// value change blocks are compressed. "+sync" compresses on the simulation
+// thread, otherwise compression overlaps with the simulation.
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->traceEverOn(true);
+    contextp->commandArgs(argc, argv);
+    const bool sync = std::strlen(contextp->commandArgsPlusMatch("sync")) != 0;
+    const char* const modep = sync ? "sync" : "parallel";
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    const std::unique_ptr<VerilatedFstC> tfp{new VerilatedFstC};
+    tfp->parallelFlush(sync ? 0 : 2);
+    topp->trace(tfp.get(), 99);
+    const std::string filename = std::string{VL_STRINGIFY(TEST_OBJ_DIR) "/simx_"} + modep + ".fst";
+    tfp->open(filename.c_str());
+
+    constexpr int CYCLES = 20000;
+    const auto start = std::chrono::steady_clock::now();
+    topp->clk = 0;
+    for (int cyc = 0; cyc < CYCLES; ++cyc) {
+        topp->clk = !topp->clk;
+        topp->eval();
+        tfp->dump(contextp->time());
+        contextp->timeInc(1);
+        if (cyc % 500 == 499) tfp->flush();
+    }
+    tfp->close();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    printf("fst trace %s flush: %.0f cycles/s\n", modep, CYCLES / elapsed.count());
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
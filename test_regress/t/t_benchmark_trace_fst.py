@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--trace-fst", "--exe", test.pli_filename])
+
+test.execute(all_run_flags=["+sync"], logfile=test.obj_dir + "/vlt_sim_sync.log")
+test.execute()
+
+test.file_grep(test.obj_dir + "/vlt_sim_sync.log", r'fst trace sync flush: [0-9]+ cycles/s')
+test.file_grep(test.run_log_filename, r'fst trace parallel flush: [0-9]+ cycles/s')
+
+# Compressing in background threads must not change the waveform
+test.fst_identical(test.obj_dir + "/simx_parallel.fst", test.obj_dir + "/simx_sync.fst")
+
+test.passes()
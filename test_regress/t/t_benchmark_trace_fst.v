@@ -0,0 +1,25 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  // Many independently toggling signals, so each value change block is large
+  reg [31:0] lfsr[256];
+
+  integer i;
+  initial begin
+    for (i = 0; i < 256; i = i + 1) lfsr[i] = i + 1;
+  end
+
+  always @(posedge clk) begin
+    for (i = 0; i < 256; i = i + 1) begin
+      lfsr[i] <= {lfsr[i][30:0], lfsr[i][31] ^ lfsr[i][21] ^ lfsr[i][1] ^ lfsr[i][0]};
+    end
+  end
+
+endmodule
@@ -0,0 +1,51 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: SAIF tracing throughput benchmark
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+#include <verilated_saif_c.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+// Measure simulation throughput with SAIF activity collection on a design
+// with wide buses, where activity accumulation dominates the trace cost.
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->traceEverOn(true);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    const std::unique_ptr<VerilatedSaifC> tfp{new VerilatedSaifC};
+    topp->trace(tfp.get(), 99);
+    tfp->open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx.saif");
+
+    constexpr int CYCLES = 20000;
+    const auto start = std::chrono::steady_clock::now();
+    topp->clk = 0;
+    for (int cyc = 0; cyc < CYCLES; ++cyc) {
+        topp->clk = !topp->clk;
+        topp->eval();
+        tfp->dump(contextp->time());
+        contextp->timeInc(1);
+    }
+    tfp->close();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    printf("saif trace: %.0f cycles/s\n", CYCLES / elapsed.count());
+    topp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+if not test.benchmark:
+    test.skip("Benchmark only, run with --benchmark")
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--trace-saif", "--exe", test.pli_filename])
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'saif trace: [0-9]+ cycles/s')
+test.file_grep(test.obj_dir + "/simx.saif", r'\(bus\\\[2047\\\]')
+
+test.passes()
@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  // Wide buses where only some bits toggle each cycle
+  reg [2047:0] bus;
+  reg [199:0] shift[64];
+  reg [31:0] lfsr;
+
+  integer i;
+  initial begin
+    bus = '0;
+    lfsr = 32'h1;
+    for (i = 0; i < 64; i = i + 1) shift[i] = 200'(i + 1);
+  end
+
+  always @(posedge clk) begin
+    lfsr <= {lfsr[30:0], lfsr[31] ^ lfsr[21] ^ lfsr[1] ^ lfsr[0]};
+    bus <= {bus[2015:0], lfsr};
+    for (i = 0; i < 64; i = i + 1) shift[i] <= {shift[i][198:0], shift[i][199]};
+  end
+
+endmodule
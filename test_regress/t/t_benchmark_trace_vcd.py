@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_benchmark_trace_fst.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--trace-vcd", "--exe", test.pli_filename])
+
+test.execute(all_run_flags=["+sync"], logfile=test.obj_dir + "/vlt_sim_sync.log")
+test.execute()
+
+test.file_grep(test.obj_dir + "/vlt_sim_sync.log", r'vcd trace sync flush: [0-9]+ cycles/s')
+test.file_grep(test.run_log_filename, r'vcd trace parallel flush: [0-9]+ cycles/s')
+
+# Writing from a background thread must not change the waveform
+test.vcd_identical(test.obj_dir + "/simx_parallel.vcd", test.obj_dir + "/simx_sync.vcd")
+
+test.passes()
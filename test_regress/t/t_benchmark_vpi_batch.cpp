@@ -0,0 +1,162 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: Batched VPI value access benchmark
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static constexpr int ITERATIONS = 2000;
+
+static std::vector<vpiHandle> s_handles;
+static std::vector<int> s_words;  // Words per handle
+static size_t s_totalWords = 0;
+
+static uint32_t s_rng = 1;
+static uint32_t rand32() {
+    s_rng = s_rng * 1664525U + 1013904223U;
+    return s_rng;
+}
+
+static void addHandle(vpiHandle handle) {
+    TEST_CHECK_NZ(handle);
+    const int words = VL_WORDS_I(vpi_get(vpiSize, handle));
+    s_handles.push_back(handle);
+    s_words.push_back(words);
+    s_totalWords += words;
+}
+
+// Per-handle reference implementations of the batched calls
+static void getEach(uint32_t* wordsp) {
+    for (size_t n = 0; n < s_handles.size(); ++n) {
+        s_vpi_value value;
+        value.format = vpiVectorVal;
+        vpi_get_value(s_handles[n], &value);
+        for (int i = 0; i < s_words[n]; ++i) *wordsp++ = value.value.vector[i].aval;
+    }
+}
+static void putEach(const uint32_t* wordsp) {
+    s_vpi_vecval vec[VL_WORDS_I(200)];
+    for (size_t n = 0; n < s_handles.size(); ++n) {
+        for (int i = 0; i < s_words[n]; ++i) vec[i] = s_vpi_vecval{*wordsp++, 0};
+        s_vpi_value value;
+        value.format = vpiVectorVal;
+        value.value.vector = vec;
+        vpi_put_value(s_handles[n], &value, nullptr, vpiNoDelay);
+    }
+}
+
+template <typename T_Func>
+static void bench(const char* opp, const char* pathp, T_Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) func();
+    const double secs
+        = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    VL_PRINTF("vpi %s %s: %8.2f ns/handle\n", opp, pathp,
+              secs * 1e9 / ITERATIONS / s_handles.size());
+}
+
+static void check() {
+    std::vector<uint32_t> in(s_totalWords);
+    std::vector<uint32_t> out(s_totalWords);
+    std::vector<uint32_t> exp(s_totalWords);
+    for (int iter = 0; iter < 10; ++iter) {
+        for (uint32_t& word : in) word = rand32();
+        // Batched put, per-handle get
+        TEST_CHECK_EQ(VerilatedVpi::putValues(s_handles.size(), s_handles.data(), in.data()),
+                      true);
+        getEach(exp.data());
+        // Batched get must match, and must mask off bits beyond each signal
+        TEST_CHECK_EQ(VerilatedVpi::getValues(s_handles.size(), s_handles.data(), out.data()),
+                      true);
+        for (size_t i = 0; i < s_totalWords; ++i) TEST_CHECK_EQ(out[i], exp[i]);
+        // Per-handle put must leave the same state
+        putEach(in.data());
+        TEST_CHECK_EQ(VerilatedVpi::getValues(s_handles.size(), s_handles.data(), out.data()),
+                      true);
+        for (size_t i = 0; i < s_totalWords; ++i) TEST_CHECK_EQ(out[i], exp[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->eval();
+
+    for (const char* namep :
+         {"t.sig7", "t.sig16", "t.sig32", "t.sig41", "t.sig64", "t.sig70", "t.sig200"}) {
+        addHandle(vpi_handle_by_name(const_cast<PLI_BYTE8*>(namep), nullptr));
+    }
+    vpiHandle memh = vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.mem"), nullptr);
+    TEST_CHECK_NZ(memh);
+    for (int i = 0; i < 256; ++i) addHandle(vpi_handle_by_index(memh, i));
+    // Bit and part selects take the shifted path
+    addHandle(vpi_handle_by_index(s_handles[5], 67));
+    if (errors) return 10;
+
+    check();
+
+    // Whole arrays have no single value, so are rejected rather than accessed as element 0
+    uint32_t elem0[2];
+    TEST_CHECK_EQ(VerilatedVpi::getValues(1, &s_handles[7], elem0), true);
+    const uint32_t other[2] = {~elem0[0], ~elem0[1]};
+    uint32_t arrayWords[2] = {0, 0};
+    TEST_CHECK_EQ(VerilatedVpi::getValues(1, &memh, arrayWords), false);
+    TEST_CHECK_EQ(vpi_chk_error(nullptr), vpiError);
+    TEST_CHECK_EQ(arrayWords[0], 0);
+    TEST_CHECK_EQ(VerilatedVpi::putValues(1, &memh, other), false);
+    TEST_CHECK_EQ(vpi_chk_error(nullptr), vpiError);
+    uint32_t after[2];
+    TEST_CHECK_EQ(VerilatedVpi::getValues(1, &s_handles[7], after), true);
+    TEST_CHECK_EQ(after[0], elem0[0]);
+    TEST_CHECK_EQ(after[1], elem0[1]);
+
+    std::vector<uint32_t> words(s_totalWords);
+    for (uint32_t& word : words) word = rand32();
+    bench("get", "per-handle", [&]() { getEach(words.data()); });
+    bench("get", "batched",
+          [&]() { VerilatedVpi::getValues(s_handles.size(), s_handles.data(), words.data()); });
+    bench("put", "per-handle", [&]() { putEach(words.data()); });
+    bench("put", "batched",
+          [&]() { VerilatedVpi::putValues(s_handles.size(), s_handles.data(), words.data()); });
+
+    for (vpiHandle handle : s_handles) vpi_release_handle(handle);
+    vpi_release_handle(memh);
+
+    topp->clk = 0;
+    topp->eval();
+    topp->clk = 1;
+    topp->eval();
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+    topp->final();
+
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe --vpi", test.pli_filename, "-CFLAGS", "-O2"])
+
+test.execute()
+
+for op in ['get', 'put']:
+    for path in ['per-handle', 'batched']:
+        test.file_grep(test.run_log_filename, r'vpi ' + op + r' +' + path + r': +[0-9.]+ ns/handle')
+
+test.passes()
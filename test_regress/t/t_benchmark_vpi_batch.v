@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (  /*AUTOARG*/
+    // Inputs
+    input clk
+);
+
+  reg [6:0] sig7  /*verilator public_flat_rw */;
+  reg [15:0] sig16  /*verilator public_flat_rw */;
+  reg [31:0] sig32  /*verilator public_flat_rw */;
+  reg [40:0] sig41  /*verilator public_flat_rw */;
+  reg [63:0] sig64  /*verilator public_flat_rw */;
+  reg [69:0] sig70  /*verilator public_flat_rw */;
+  reg [199:0] sig200  /*verilator public_flat_rw */;
+  reg [40:0] mem[0:255]  /*verilator public_flat_rw */;
+
+  always @(posedge clk) begin
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+
+endmodule : t
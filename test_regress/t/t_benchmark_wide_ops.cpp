@@ -0,0 +1,121 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: Wide operator kernel benchmark
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include VM_PREFIX_INCLUDE
+
+#include <chrono>
+#include <memory>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static constexpr int MAX_WORDS = VL_WORDS_I(2048);
+static constexpr int ITERATIONS = 200000;
+
+static VlWide<MAX_WORDS> s_lhs;
+static VlWide<MAX_WORDS> s_rhs;
+static VlWide<MAX_WORDS> s_out;
+static IData s_sink = 0;  // Consumes results, so they are not optimized away
+
+template <typename T_Func>
+static void bench(const char* namep, int bits, int iterations, T_Func func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) func(i);
+    const double secs
+        = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    VL_PRINTF("wide %-7s %4d bits: %8.2f Mops/s\n", namep, bits, iterations / secs / 1e6);
+}
+
+static void check(int words) {
+    // Results against word at a time references
+    EData andr = 0;
+    EData xorr = 0;
+    VL_XOR_W(words, s_out, s_lhs, s_rhs);
+    for (int i = 0; i < words; ++i) {
+        TEST_CHECK_EQ(s_out[i], s_lhs[i] ^ s_rhs[i]);
+        andr |= s_lhs[i] & s_rhs[i];
+        xorr ^= s_lhs[i];
+    }
+    VL_AND_W(words, s_out, s_lhs, s_rhs);
+    TEST_CHECK_EQ(VL_REDOR_W(words, s_out), andr != 0);
+    TEST_CHECK_EQ(VL_REDXOR_W(words, s_lhs), VL_REDXOR_32(xorr));
+    TEST_CHECK_EQ(VL_EQ_W(words, s_lhs, s_lhs), 1);
+    TEST_CHECK_EQ(VL_EQ_W(words, s_lhs, s_rhs), 0);
+    // Multiply by one, and by two
+    VlWide<MAX_WORDS> num;
+    VL_ZERO_W(words * VL_EDATASIZE, num);
+    num[0] = 1;
+    VL_MUL_W(words, s_out, s_lhs, num);
+    TEST_CHECK_EQ(VL_EQ_W(words, s_out, s_lhs), 1);
+    num[0] = 2;
+    VL_MUL_W(words, s_out, num, s_lhs);
+    VL_ADD_W(words, num, s_lhs, s_lhs);
+    TEST_CHECK_EQ(VL_EQ_W(words, s_out, num), 1);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    for (int i = 0; i < MAX_WORDS; ++i) {
+        s_lhs[i] = 0x9e3779b9U * (i + 1);
+        s_rhs[i] = 0x85ebca6bU * (i + 7);
+    }
+
+    for (const int bits : {512, 1024, 2048}) {
+        const int words = VL_WORDS_I(bits);
+        check(words);
+        bench("and", bits, ITERATIONS, [=](int) {
+            VL_AND_W(words, s_out, s_lhs, s_rhs);
+            s_sink += s_out[1];
+        });
+        bench("or", bits, ITERATIONS, [=](int) {
+            VL_OR_W(words, s_out, s_lhs, s_rhs);
+            s_sink += s_out[1];
+        });
+        bench("xor", bits, ITERATIONS, [=](int) {
+            VL_XOR_W(words, s_out, s_lhs, s_rhs);
+            s_sink += s_out[1];
+        });
+        bench("not", bits, ITERATIONS, [=](int) {
+            VL_NOT_W(words, s_out, s_lhs);
+            s_sink += s_out[1];
+        });
+        bench("eq", bits, ITERATIONS, [=](int) { s_sink += VL_EQ_W(words, s_lhs, s_rhs); });
+        bench("redor", bits, ITERATIONS, [=](int) { s_sink += VL_REDOR_W(words, s_lhs); });
+        bench("redxor", bits, ITERATIONS, [=](int) { s_sink += VL_REDXOR_W(words, s_lhs); });
+        bench("add", bits, ITERATIONS, [=](int) {
+            VL_ADD_W(words, s_out, s_lhs, s_rhs);
+            s_sink += s_out[1];
+        });
+        bench("mul", bits, ITERATIONS / 100, [=](int) {
+            VL_MUL_W(words, s_out, s_lhs, s_rhs);
+            s_sink += s_out[1];
+        });
+        bench("shiftl", bits, ITERATIONS, [=](int i) {
+            VL_SHIFTL_WWI(bits, bits, 32, s_out, s_lhs, (i & 127) + 1);
+            s_sink += s_out[1];
+        });
+        bench("concat", bits, ITERATIONS, [=](int) {
+            VL_CONCAT_WWW(bits, bits - 100, 100, s_out, s_lhs, s_rhs);
+            s_sink += s_out[1];
+        });
+    }
+    VL_PRINTF("wide checksum: %08x\n", s_sink);
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
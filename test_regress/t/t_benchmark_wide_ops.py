@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_skipidentical.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe", test.pli_filename, "-CFLAGS", "-O2"])
+
+test.execute()
+
+for op in ['and', 'or', 'xor', 'not', 'eq', 'redor', 'redxor', 'add', 'mul', 'shiftl', 'concat']:
+    for bits in [512, 1024, 2048]:
+        test.file_grep(test.run_log_filename, r'wide ' + op + r' +' + str(bits) + r' bits: +[0-9.]+ Mops/s')
+
+test.passes()
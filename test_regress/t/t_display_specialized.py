@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile()
+
+# Constant formats use VlFormat, the runtime formats still use _vl_vsformat
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*.cpp")
+test.file_grep_any(files, r'VlFormat\{\}')
+test.file_grep_any(files, r'VL_SFORMATF_N_NX\(')
+test.file_grep_any(files, r'VlFormat::F_SIGNED\|VlFormat::F_LEFT\)')
+test.file_grep_any(files, r'VlFormat::F_ZERO\)')
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'display [0-9]+ [0-9a-f]{2} abc top\.t')
+
+test.passes()
@@ -0,0 +1,59 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checks(gotv,expv) do if ((gotv) != (expv)) begin $write("%%Error: %s:%0d:  got='%s' exp='%s'\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+// verilog_format: on
+
+// Constant formats are converted at Verilation time; a format held in a
+// variable is parsed at runtime. Both must print the same.
+module t;
+  bit [6:0] b7;
+  logic signed [12:0] s13;
+  bit [31:0] u32;
+  int signed i32;
+  bit [47:0] b48;
+  longint signed s64;
+  string str;
+  string pct;
+  string got;
+
+  initial begin
+    pct = "%";  // Runtime formats are built from this
+    str = "abc";
+    for (int i = 0; i < 50; ++i) begin
+      b7 = 7'($urandom);
+      s13 = 13'($urandom);
+      u32 = $urandom >> (i % 32);
+      i32 = (i % 2) ? -$urandom : $urandom;
+      b48 = {$urandom, $urandom} >> (i % 48);
+      s64 = {$urandom, $urandom};
+      if (i == 0) begin
+        u32 = 0;
+        s64 = 0;
+      end
+
+      got = $sformatf("d%d %0d %5d %05d %-5d|", b7, s13, u32, i32, s64);
+      `checks(got, $sformatf({"d", pct, "d ", pct, "0d ", pct, "5d ", pct, "05d ", pct, "-5d|"},
+                             b7, s13, u32, i32, s64));
+      got = $sformatf("h%h %0h %12x %-3h|", b7, s13, b48, s64);
+      `checks(got, $sformatf({"h", pct, "h ", pct, "0h ", pct, "12x ", pct, "-3h|"},
+                             b7, s13, b48, s64));
+      got = $sformatf("b%b %0b %20b o%o %0o %o|", b7, s13, u32, b48, i32, s64);
+      `checks(got, $sformatf({"b", pct, "b ", pct, "0b ", pct, "20b o", pct, "o ", pct, "0o ",
+                              pct, "o|"}, b7, s13, u32, b48, i32, s64));
+      got = $sformatf("s%s %8s %0s %-6s %c %% %s|", b48, u32, s64, str, b7, str);
+      `checks(got, $sformatf({"s", pct, "s ", pct, "8s ", pct, "0s ", pct, "-6s ", pct, "c ",
+                              pct, pct, " ", pct, "s|"}, b48, u32, s64, str, b7, str));
+      $sformat(got, "m %m %d", u32);
+      `checks(got, $sformatf({"m ", pct, "m ", pct, "d"}, u32));
+    end
+    $display("display %0d %h %s %m", u32, b7, str);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
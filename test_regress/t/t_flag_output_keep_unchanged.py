@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import time
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_skipidentical.v"
+
+flags = ['--output-keep-unchanged', '--no-skip-identical']
+
+test.compile(verilator_flags2=flags)
+
+cpp_filename = test.obj_dir + "/V" + test.name + ".cpp"
+mk_filename = test.obj_dir + "/V" + test.name + ".mk"
+cpp_time = os.path.getmtime(cpp_filename)
+mk_time = os.path.getmtime(mk_filename)
+
+time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+
+os.utime(test.top_filename, None)
+test.compile(verilator_flags2=flags)
+
+if os.path.getmtime(cpp_filename) != cpp_time:
+    test.error("--output-keep-unchanged was ignored -- rewrote " + cpp_filename)
+if os.path.getmtime(mk_filename) == mk_time:
+    test.error("Makefile should always be rewritten: " + mk_filename)
+
+test.passes()
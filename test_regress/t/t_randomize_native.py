@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+# Deliberately no have_solver check: these constraints are solved in-process,
+# so the run must pass with VERILATOR_SOLVER pointing at no solver
+
+test.compile()
+
+# Set on the command line, as execute() replaces VERILATOR_SOLVER in os.environ
+test.execute(run_env='VERILATOR_SOLVER=false')
+
+test.passes()
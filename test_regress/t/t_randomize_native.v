@@ -0,0 +1,82 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+typedef enum bit [2:0] {
+  READ = 3'd1,
+  WRITE = 3'd3,
+  FLUSH = 3'd6
+} op_t;
+
+class Packet;
+  int unsigned limit = 32'h1000;  // State, not randomized
+  rand bit [31:0] addr;
+  rand bit [7:0] len;
+  rand op_t op;
+  rand int signed offset;
+  rand bit [63:0] tag;
+  rand bit [3:0] prio;
+
+  constraint c_addr {
+    addr[1:0] == 2'b00;
+    addr < limit;
+    addr + len <= limit;
+  }
+  constraint c_len {len inside {[1 : 64]};}
+  constraint c_op {
+    (op == READ) -> len <= 8;
+    if (op == FLUSH) prio == 0;
+    else prio != 0;
+  }
+  constraint c_offset {offset inside {[-100 : 100]};}
+  constraint c_tag {tag == {32'hcafe, addr} + 64'd5;}
+  constraint c_soft {soft len > 4;}
+
+  function void check();
+    if (addr[1:0] != 0 || addr >= limit || addr + len > limit) $stop;
+    if (len < 1 || len > 64 || len <= 4) $stop;
+    if (op != READ && op != WRITE && op != FLUSH) $stop;
+    if (op == READ && len > 8) $stop;
+    if ((op == FLUSH) != (prio == 0)) $stop;
+    if (offset < -100 || offset > 100) $stop;
+    if (tag != {32'hcafe, addr} + 64'd5) $stop;
+  endfunction
+endclass
+
+module t;
+  Packet p;
+  int ops[op_t];
+  int negative;
+
+  initial begin
+    p = new;
+    // No SMT solver is needed for these constraints, the driver runs without one
+    for (int i = 0; i < 1000; ++i) begin
+      if (p.randomize() != 1) $stop;
+      p.check();
+      ops[p.op]++;
+      if (p.offset < 0) negative++;
+      if (p.randomize(null) != 1) $stop;
+    end
+    if (ops.size() != 3 || negative == 0) $stop;
+
+    // rand_mode(0) variables keep their value
+    p.addr.rand_mode(0);
+    p.addr = 32'h40;
+    for (int i = 0; i < 20; ++i) begin
+      if (p.randomize() != 1) $stop;
+      p.check();
+      if (p.addr != 32'h40) $stop;
+    end
+    p.addr.rand_mode(1);
+
+    // Check-only reports violated constraints
+    p.len = 0;
+    if (p.randomize(null) != 0) $stop;
+
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
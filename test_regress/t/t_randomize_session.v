@@ -0,0 +1,79 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+// verilog_format: on
+
+class Item;
+  rand bit [31:0] addr;
+  rand bit [7:0] len;
+  rand bit [3:0] kind;
+
+  constraint c_addr {addr[1:0] == 2'b00; addr < 32'h1000_0000;}
+  constraint c_len {len inside {[1 : 64]};}
+  constraint c_kind {kind != 4'hf; (kind == 0) -> len == 1;}
+
+  function void check(bit withAddr);
+    if (withAddr && (addr[1:0] != 0 || addr >= 32'h1000_0000)) $stop;
+    if (len < 1 || len > 64) $stop;
+    if (kind == 4'hf || (kind == 0 && len != 1)) $stop;
+  endfunction
+endclass
+
+module t;
+
+  // The solver keeps the constraints of the last randomize() loaded between
+  // calls. Each call here changes what must be loaded, and each result must
+  // follow that call's constraints, not those left from the previous call.
+  Item item;
+  int unaligned;
+
+  initial begin
+    item = new;
+    unaligned = 0;
+    for (int i = 0; i < 60; ++i) begin
+      case (i % 5)
+        0: begin
+          `checkd(item.randomize(), 1);
+          item.check(1);
+        end
+        1: begin
+          `checkd(item.randomize() with {len == 7;}, 1);
+          item.check(1);
+          `checkd(item.len, 7);
+        end
+        2: begin
+          item.c_addr.constraint_mode(0);
+          `checkd(item.randomize() with {addr[1:0] != 0;}, 1);
+          item.check(0);
+          if (item.addr[1:0] != 0) ++unaligned;
+          item.c_addr.constraint_mode(1);
+        end
+        3: begin
+          item.kind = 4'h3;
+          item.kind.rand_mode(0);
+          `checkd(item.randomize(), 1);
+          item.check(1);
+          `checkd(item.kind, 4'h3);
+          item.kind.rand_mode(1);
+        end
+        default: begin
+          // Check only, against the values of the previous call
+          `checkd(item.randomize(null), 1);
+          item.len = 0;
+          `checkd(item.randomize(null), 0);
+          `checkd(item.randomize(), 1);
+          item.check(1);
+        end
+      endcase
+    end
+    `checkd(unaligned, 12);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
@@ -0,0 +1,44 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+// verilog_format: on
+
+module t;
+  localparam LINES = 200;
+
+  string filename;
+
+  // Count the lines of the log file written so far
+  function automatic int count_lines();
+    string line;
+    int count = 0;
+    int fd;
+    fd = $fopen(filename, "r");
+    if (fd == 0) `stop;
+    while ($fgets(line, fd) != 0) begin
+      if (line.substr(0, 4) == "line ") ++count;
+    end
+    $fclose(fd);
+    return count;
+  endfunction
+
+  initial begin
+    if (!$value$plusargs("logfile=%s", filename)) `stop;
+    // $fflush of stdout must write $display output still pending in the background thread
+    for (int i = 0; i < LINES; ++i) $display("line %0d", i);
+    $fflush(32'h8000_0001);
+    `checkd(count_lines(), LINES);
+    // Likewise $fclose of a multichannel descriptor including stdout
+    for (int i = 0; i < LINES; ++i) $display("line %0d", LINES + i);
+    $fclose(32'h1);
+    `checkd(count_lines(), 2 * LINES);
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=['--stats'], threads=4)
+
+test.file_grep(test.stats, r'MTask graph, final, mtask count\s+([2-9]|\d\d+)')
+
+sync_log = test.obj_dir + "/sync.log"
+async_log = test.obj_dir + "/async.log"
+test.execute(logfile=sync_log)
+test.execute(all_run_flags=["+verilator+log+async"], logfile=async_log)
+
+
+def blk_lines(filename):
+    return [line for line in test.file_contents(filename).splitlines() if line.startswith("blk ")]
+
+
+sync_lines = blk_lines(sync_log)
+async_lines = blk_lines(async_log)
+
+# Mtasks may print in any order within a cycle, but no line may be lost or torn
+if not sync_lines:
+    test.error("No block output in " + sync_log)
+if sorted(sync_lines) != sorted(async_lines):
+    test.error("Asynchronous output differs from synchronous output")
+
+# Each block's lines must stay in cycle order
+last_cyc = {}
+for line in async_lines:
+    fields = line.split()
+    blk = int(fields[1])
+    cyc = int(fields[3])
+    if cyc != last_cyc.get(blk, -1) + 1:
+        test.error("Out of order output from block " + str(blk) + ": " + line)
+    last_cyc[blk] = cyc
+
+test.passes()
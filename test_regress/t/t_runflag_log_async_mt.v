@@ -0,0 +1,37 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  localparam BLOCKS = 8;
+  localparam CYCLES = 50;
+
+  int cyc;
+
+  // Independent blocks, so each may display from a different mtask
+  for (genvar b = 0; b < BLOCKS; ++b) begin : gen_blk
+    logic [63:0] lfsr = 64'h1 + b;
+    always @(posedge clk) begin
+      logic [63:0] next;
+      next = lfsr;
+      for (int i = 0; i < 32; ++i) begin
+        next = {next[62:0], next[63] ^ next[62] ^ next[60] ^ next[59]} + i;
+      end
+      lfsr <= next;
+      $display("blk %0d cyc %0d lfsr %h", b, cyc, next);
+    end
+  end
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc == CYCLES) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+endmodule
@@ -0,0 +1,128 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+#if VM_TRACE
+#include <verilated_vcd_c.h>
+#endif
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static std::string readFile(const std::string& filename) {
+    std::ifstream ifs{filename, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+}
+
+#if VM_TRACE
+// Trace with a background writer thread, open while forking; the forked
+// child has no such thread, so must exit without waiting on it
+static VerilatedVcdC* s_tfp = nullptr;
+#endif
+
+static void step(VerilatedContext* contextp, VM_PREFIX* topp) {
+    contextp->timeInc(1);
+    topp->clk = !topp->clk;
+    topp->eval();
+#if VM_TRACE
+    if (s_tfp) s_tfp->dump(contextp->time());
+#endif
+}
+
+static void runToFinish(VerilatedContext* contextp, VM_PREFIX* topp) {
+    while (!contextp->gotFinish() && contextp->time() < 1000) step(contextp, topp);
+    TEST_CHECK_EQ(contextp->gotFinish(), true);
+}
+
+int main(int argc, char* argv[]) {
+    const std::string dir = VL_STRINGIFY(TEST_OBJ_DIR);
+    const std::string plainName = dir + "/plain.vltsv";
+    const std::string forkedName = dir + "/forked.vltsv";
+    const std::string pipeName = dir + "/pipe.vltsv.gz";
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+#if VM_TRACE
+        contextp->traceEverOn(true);
+#endif
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+#if VM_TRACE
+        const std::unique_ptr<VerilatedVcdC> tfp{new VerilatedVcdC};
+        topp->trace(tfp.get(), 99);
+        tfp->parallelFlush(2);
+        tfp->open((dir + "/simx.vcd").c_str());
+        s_tfp = tfp.get();
+#endif
+        topp->clk = 0;
+        topp->eval();
+        while (contextp->time() < 50) step(contextp.get(), topp.get());
+        {
+            VerilatedSave os;
+            os.open(plainName);
+            TEST_CHECK_EQ(os.isOpen(), true);
+            os << *topp;
+        }
+        {
+            VerilatedSave os;
+            os.openForked(forkedName);
+            // Only the child process writes; the destructor exits it
+            if (os.isOpen()) os << *topp;
+        }
+        {
+            VerilatedSave os;
+            os.open("| gzip -1 > " + pipeName);
+            TEST_CHECK_EQ(os.isOpen(), true);
+            os << *topp;
+        }
+        // Parent continues while the forked save is written
+        runToFinish(contextp.get(), topp.get());
+        topp->final();
+#if VM_TRACE
+        s_tfp = nullptr;
+        tfp->close();
+#endif
+    }
+    TEST_CHECK_EQ(VerilatedSave::waitForked(), true);
+    TEST_CHECK_EQ(readFile(forkedName) == readFile(plainName), true);
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+        {
+            VerilatedRestore os;
+            os.open("| gzip -dc " + pipeName);
+            TEST_CHECK_EQ(os.isOpen(), true);
+            os >> *topp;
+        }
+        VL_PRINTF("Restored from pipe at time %" PRIu64 "\n", contextp->time());
+        TEST_CHECK_EQ(contextp->time(), 50);
+        {
+            // The child fails when the command does, and must exit without
+            // running this process's exit handling
+            VerilatedSave os;
+            os.openForked("| cat > /dev/null; exit 3");
+            if (os.isOpen()) os << *topp;
+        }
+        TEST_CHECK_EQ(VerilatedSave::waitForked(), false);
+        runToFinish(contextp.get(), topp.get());
+        topp->final();
+    }
+
+    return errors ? 10 : 0;
+}
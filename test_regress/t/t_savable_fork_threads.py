@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_savable.v"
+test.pli_filename = "t/t_savable_fork.cpp"
+
+test.compile(v_flags2=["--savable --trace-vcd --exe", test.pli_filename],
+             make_main=False,
+             threads=2)
+
+test.execute()
+
+test.file_grep(test.run_log_filename, r'Restored from pipe')
+test.file_grep(test.run_log_filename, r'%Error: Save pipe command failed')
+
+test.passes()
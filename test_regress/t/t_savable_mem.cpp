@@ -0,0 +1,65 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <memory>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static void runToFinish(VerilatedContext* contextp, VM_PREFIX* topp) {
+    while (!contextp->gotFinish() && contextp->time() < 1000) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+    TEST_CHECK_EQ(contextp->gotFinish(), true);
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    topp->clk = 0;
+    topp->eval();
+    while (contextp->time() < 50) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+
+    // Warm up once, then rewind to the snapshot for each run
+    VerilatedSaveMem snapshot;
+    snapshot.open();
+    snapshot << *topp;
+    snapshot.close();
+    runToFinish(contextp.get(), topp.get());
+
+    int rewinds = 0;
+    for (; rewinds < 3; ++rewinds) {
+        VerilatedRestoreMem os;
+        os.open(snapshot);
+        TEST_CHECK_EQ(os.isOpen(), true);
+        os >> *topp;
+        os.close();
+        TEST_CHECK_EQ(contextp->time(), 50);
+        TEST_CHECK_EQ(contextp->gotFinish(), false);
+        runToFinish(contextp.get(), topp.get());
+    }
+    VL_PRINTF("Rewound %d times\n", rewinds);
+    topp->final();
+
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,69 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_syms.h>
+
+#include VM_PREFIX_INCLUDE
+
+#include <string>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+// Look up every scope and variable by name through the hashed indexes.
+// Names are copied so lookups must match on contents, not on the pointers
+// the maps were built with.
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    topp->CLK = 0;
+    topp->eval();
+
+    int scopes = 0;
+    int vars = 0;
+    const VerilatedScopeNameMap* const scopeMapp = contextp->scopeNameMap();
+    for (const auto& scopeIt : *scopeMapp) {
+        const std::string scopeName{scopeIt.first};
+        TEST_CHECK_EQ(contextp->scopeFind(scopeName.c_str()), scopeIt.second);
+        // Prefixes and extensions of a name must not match
+        TEST_CHECK_Z(contextp->scopeFind((scopeName + "x").c_str()));
+        const std::string scopePrefix = scopeName.substr(0, scopeName.size() - 1);
+        if (!scopeMapp->count(scopePrefix.c_str())) {
+            TEST_CHECK_Z(contextp->scopeFind(scopePrefix.c_str()));
+        }
+        ++scopes;
+
+        VerilatedVarNameMap* const varsp = scopeIt.second->varsp();
+        if (!varsp) continue;
+        for (auto& varIt : *varsp) {
+            const std::string varName{varIt.first};
+            TEST_CHECK_EQ(scopeIt.second->varFind(varName.c_str()), &varIt.second);
+            TEST_CHECK_Z(scopeIt.second->varFind((varName + "x").c_str()));
+            ++vars;
+        }
+    }
+    TEST_CHECK_Z(contextp->scopeFind("top.t.no_such_scope"));
+    TEST_CHECK_Z(contextp->scopeFind(""));
+    // t_scope_map.v has 15 public foo instances, one under bar
+    TEST_CHECK(scopes, 15, scopes >= 15);
+    TEST_CHECK(vars, 15, vars >= 15);
+
+    const VerilatedScope* const scopep = contextp->scopeFind("top.t.bar1024.foo");
+    TEST_CHECK_NZ(scopep);
+    if (scopep) TEST_CHECK_NZ(scopep->varFind("value_q"));
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
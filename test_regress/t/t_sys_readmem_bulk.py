@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import struct
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+ROWS = 4096
+
+
+def wide(i):
+    return ((i & 0xff) << 64) | (((i * 0x9e3779b9) & 0xffffffff) << 32) | (~i & 0xffffffff)
+
+
+def narrow(i):
+    return (i * 7919) & 0xfffff
+
+
+def gen():
+    # Text images, with address directives and comments in each chunk
+    with open(test.obj_dir + "/bulk_h.mem", 'w', encoding="utf8") as fh:
+        fh.write("// Generated by t_sys_readmem_bulk.py\n")
+        for i in range(ROWS):
+            if i % 1000 == 0:
+                fh.write("@%x  # skip ahead\n" % i)
+            value = "%018x" % wide(i)
+            fh.write(value[:2] + "_" + value[2:] + "\n")
+    with open(test.obj_dir + "/bulk_b.mem", 'w', encoding="utf8") as fh:
+        for i in range(ROWS):
+            fh.write("{:020b}{}".format(narrow(i), " " if i % 8 != 7 else "\n"))
+    # Binary images, the narrow one with a gap
+    with open(test.obj_dir + "/bulk_w.bin", 'wb') as fh:
+        fh.write(b"VLMEMIM1" + struct.pack("<I", 72))
+        fh.write(struct.pack("<QQ", 0, ROWS))
+        for i in range(ROWS):
+            fh.write(wide(i).to_bytes(12, 'little'))
+    with open(test.obj_dir + "/bulk_n.bin", 'wb') as fh:
+        fh.write(b"VLMEMIM1" + struct.pack("<I", 20))
+        for (start, end) in ((0, 100), (200, ROWS)):
+            fh.write(struct.pack("<QQ", start, end - start))
+            for i in range(start, end):
+                # Bits above the width are dropped
+                fh.write((narrow(i) | 0xfff00000).to_bytes(4, 'little'))
+
+
+gen()
+
+# Small chunks so large-image chunking is exercised
+test.compile(verilator_flags2=["-CFLAGS", "-DVL_READMEM_CHUNK_BYTES=1024"])
+
+# Several threads even on a single processor host, so chunks decode in parallel
+test.execute(all_run_flags=["+verilator+readmem+threads+4"])
+
+test.passes()
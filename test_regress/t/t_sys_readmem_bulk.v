@@ -0,0 +1,49 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+`define STRINGIFY(x) `"x`"
+// verilog_format: on
+
+module t;
+  localparam ROWS = 4096;
+
+  reg [71:0] wide_txt[ROWS];
+  reg [71:0] wide_bin[ROWS];
+  reg [19:0] narrow_txt[ROWS];
+  reg [19:0] narrow_bin[ROWS];
+
+  function automatic [71:0] wide(int i);
+    wide = {i[7:0], i * 32'h9e3779b9, ~i};
+  endfunction
+
+  function automatic [19:0] narrow(int i);
+    narrow = 20'(i * 7919);
+  endfunction
+
+  initial begin
+    $readmemh({`STRINGIFY(`TEST_OBJ_DIR), "/bulk_h.mem"}, wide_txt);
+    $readmemh({`STRINGIFY(`TEST_OBJ_DIR), "/bulk_w.bin"}, wide_bin);
+    $readmemb({`STRINGIFY(`TEST_OBJ_DIR), "/bulk_b.mem"}, narrow_txt);
+    for (int i = 0; i < ROWS; ++i) narrow_bin[i] = '1;
+    $readmemb({`STRINGIFY(`TEST_OBJ_DIR), "/bulk_n.bin"}, narrow_bin);
+    for (int i = 0; i < ROWS; ++i) begin
+      `checkh(wide_txt[i], wide(i));
+      `checkh(wide_bin[i], wide(i));
+      `checkh(narrow_txt[i], narrow(i));
+      if (i >= 100 && i < 200) begin
+        `checkh(narrow_bin[i], 20'hfffff);
+      end
+      else begin
+        `checkh(narrow_bin[i], narrow(i));
+      end
+    end
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
@@ -0,0 +1,85 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+// DESCRIPTION: Verilator: Thread pool worker fed by several threads
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include VM_PREFIX_INCLUDE
+
+#include "verilated_threads.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+int errors = 0;
+
+static constexpr int PRODUCERS = 2;
+static constexpr int TASKS = 100000;  // Per producer, enough to fill the queue many times
+
+struct Counts final {
+    std::atomic<uint64_t> m_total{0};
+    uint64_t m_perProducer[PRODUCERS] = {};  // Only written by the worker
+    bool m_inOrder = true;  // Each producer's tasks ran in the order added
+};
+struct TaskArg final {
+    Counts* m_countsp;
+    int m_producer;
+};
+static TaskArg s_args[PRODUCERS];
+
+static void countTask(void* userp, bool) {
+    const TaskArg* const argp = static_cast<TaskArg*>(userp);
+    argp->m_countsp->m_perProducer[argp->m_producer]++;
+    argp->m_countsp->m_total.fetch_add(1, std::memory_order_release);
+}
+static void orderTask(void* userp, bool evenCycle) {
+    // evenCycle is used to carry the parity of this task's sequence number
+    const TaskArg* const argp = static_cast<TaskArg*>(userp);
+    const uint64_t seq = argp->m_countsp->m_perProducer[argp->m_producer];
+    if (static_cast<bool>(seq & 1) != evenCycle) argp->m_countsp->m_inOrder = false;
+    countTask(userp, evenCycle);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    contextp->threads(2);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    VlThreadPool* const poolp = static_cast<VlThreadPool*>(contextp->threadPoolp());
+    TEST_CHECK_EQ(poolp->numThreads(), 1);
+    VlWorkerThread* const workerp = poolp->workerp(0);
+
+    // Several threads add tasks to the one worker at the same time, as the
+    // eval thread and trace threads can. No task may be lost or run twice.
+    Counts counts;
+    for (int p = 0; p < PRODUCERS; ++p) s_args[p] = TaskArg{&counts, p};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([workerp, p]() {
+            for (int i = 0; i < TASKS; ++i) workerp->addTask(orderTask, &s_args[p], i & 1);
+        });
+    }
+    for (std::thread& thread : producers) thread.join();
+    workerp->wait();
+
+    TEST_CHECK_EQ(counts.m_total.load(std::memory_order_acquire),
+                  static_cast<uint64_t>(PRODUCERS * TASKS));
+    for (int p = 0; p < PRODUCERS; ++p) {
+        TEST_CHECK_EQ(counts.m_perProducer[p], static_cast<uint64_t>(TASKS));
+    }
+    TEST_CHECK_EQ(counts.m_inOrder, true);
+
+    topp->final();
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_benchmark_mux4k.v"
+
+test.compile(
+    verilator_flags2=["--stats --threads-schedule dynamic", test.wno_unopthreads_for_few_cores],
+    threads=4)
+
+test.execute()
+
+test.file_grep(test.stats, r'Optimizations, Thread schedule dynamic\s+(\d+)')
+
+test.passes()
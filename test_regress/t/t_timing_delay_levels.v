@@ -0,0 +1,61 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkd(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got=%0d exp=%0d (%s !== %s)\n", `__FILE__,`__LINE__, (gotv), (expv), `"gotv`", `"expv`"); `stop; end while(0);
+// verilog_format: on
+
+module t;
+  timeunit 1ns; timeprecision 1ns;
+
+  // Delays on both sides of each 8-bit wheel level boundary, beyond the
+  // wheel's 2^32 span, and repeated, listed out of order
+  localparam int N = 18;
+  localparam longint unsigned DELAYS[N] = '{
+      64'd65537, 64'd1, 64'd4294967296, 64'd255, 64'd16777216, 64'd256,
+      64'd1 << 40, 64'd65535, 64'd4294967295, 64'd257, 64'd16777215, 64'd65536,
+      64'd4294967297, 64'd16777217, 64'd65536, 64'd2, 64'd1, 64'd1 << 40};
+  // Delays resumed in turn by one process, each from a different base time
+  localparam int M = 6;
+  localparam longint unsigned CHAIN[M] = '{
+      64'd300, 64'd65500, 64'd16777000, 64'd4294967000, 64'd1 << 36, 64'd3};
+
+  longint unsigned resumed[$];  // Time of each resume, in resume order
+
+  for (genvar i = 0; i < N; ++i) begin : g_proc
+    initial begin
+      #(DELAYS[i]);
+      `checkd($time, DELAYS[i]);
+      resumed.push_back($time);
+    end
+  end
+
+  initial begin
+    longint unsigned expected;
+    expected = 0;
+    for (int i = 0; i < M; ++i) begin
+      #(CHAIN[i]);
+      expected += CHAIN[i];
+      `checkd($time, expected);
+      resumed.push_back($time);
+    end
+  end
+
+  initial begin
+    #((64'd1 << 40) + 1);
+    `checkd(resumed.size(), N + M);
+    for (int i = 1; i < resumed.size(); ++i) begin
+      if (resumed[i] < resumed[i-1]) begin
+        $write("%%Error: resume %0d at %0d after %0d\n", i, resumed[i], resumed[i-1]);
+        `stop;
+      end
+    end
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+
+endmodule
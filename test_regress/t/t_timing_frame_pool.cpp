@@ -0,0 +1,69 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include <verilated.h>
+
+#include <cstdio>
+#include <memory>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+#include VM_PREFIX_INCLUDE
+
+int errors = 0;
+
+struct Sim final {
+    std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+};
+
+static void run(Sim& sim) {
+    Verilated::threadContextp(sim.contextp.get());
+    while (!sim.contextp->gotFinish()) {
+        sim.topp->eval();
+        if (!sim.topp->eventsPending()) break;
+        sim.contextp->time(sim.topp->nextTimeSlot());
+    }
+    sim.topp->final();
+}
+
+int main(int argc, char** argv) {
+    Sim sim1;
+    Sim sim2;
+    sim1.contextp->debug(0);
+    sim1.contextp->commandArgs(argc, argv);
+    sim2.contextp->commandArgs(argc, argv);
+
+    run(sim1);
+    const uint64_t allocated = sim1.contextp->statCoroutineFramesAllocated();
+    const uint64_t reused = sim1.contextp->statCoroutineFramesReused();
+    printf("coroutine frames allocated: %" PRIu64 ", reused: %" PRIu64 "\n", allocated,
+           reused);
+
+    // 1000 forked processes, at most 10 alive at a time, so most frames are reused
+    TEST_CHECK_NE(allocated, 0);
+    TEST_CHECK_EQ(reused + allocated >= 1000, true);
+    TEST_CHECK_EQ(reused > allocated, true);
+    // Frames are counted only in the context that ran them
+    TEST_CHECK_Z(sim2.contextp->statCoroutineFramesAllocated());
+    TEST_CHECK_Z(sim2.contextp->statCoroutineFramesReused());
+
+    run(sim2);
+    TEST_CHECK_EQ(sim2.contextp->statCoroutineFramesAllocated()
+                          + sim2.contextp->statCoroutineFramesReused()
+                      >= 1000,
+                  true);
+    TEST_CHECK_EQ(sim1.contextp->statCoroutineFramesAllocated(), allocated);
+    TEST_CHECK_EQ(sim1.contextp->statCoroutineFramesReused(), reused);
+
+    return errors ? 10 : 0;
+}
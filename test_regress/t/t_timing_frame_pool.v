@@ -0,0 +1,31 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+  int done = 0;
+
+  task automatic short_task(int i);
+    #(1 + i % 3);
+    done++;
+  endtask
+
+  // Repeatedly fork short-lived processes, so their coroutine frames get reused
+  initial begin
+    for (int n = 0; n < 100; ++n) begin
+      for (int i = 0; i < 10; ++i) begin
+        fork
+          short_task(i);
+        join_none
+      end
+      #5;
+    end
+    if (done != 1000) $stop;
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+
+endmodule
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of either the GNU Lesser General Public License Version 3
+# or the Perl Artistic License Version 2.0.
+# SPDX-FileCopyrightText: 2026 Wilson Snyder
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('dist')
+test.golden_filename = "t/t_vlcov_merge.out"
+
+# Merge in parallel into a binary file
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+    "--threads",
+    "3",
+    "--write-binary",
+    test.obj_dir + "/coverage.bin",
+    "t/t_vlcov_data_a.dat",
+    "t/t_vlcov_data_b.dat",
+    "t/t_vlcov_data_c.dat",
+    "t/t_vlcov_data_d.dat",
+],
+         verilator_run=True)
+
+# Reading it back must give the same result as merging the text files
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+    "--threads",
+    "1",
+    "--write",
+    test.obj_dir + "/coverage.dat",
+    test.obj_dir + "/coverage.bin",
+],
+         verilator_run=True)
+
+test.files_identical_sorted(test.obj_dir + "/coverage.dat", test.golden_filename)
+
+test.passes()
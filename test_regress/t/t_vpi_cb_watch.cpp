@@ -0,0 +1,194 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of either the GNU Lesser General Public License Version 3
+// or the Perl Artistic License Version 2.0.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+// Checks cbValueChange callbacks that share a signal, and callbacks added
+// and removed while callValueCbs is scanning. 'count' changes by one on
+// each posedge, so the value seen by a callback is also the change number.
+
+int errors = 0;
+
+unsigned int main_time = 0;
+
+TestVpiHandle vh_count;  // Shared by several callbacks
+TestVpiHandle vh_victim_cb;  // Removed by the remover, while scanning
+TestVpiHandle vh_self_cb;  // Removes itself
+TestVpiHandle vh_late_cb;  // Added by the adder, while scanning
+
+int a_calls = 0;
+int shared_calls = 0;
+int victim_calls = 0;
+int self_calls = 0;
+int late_calls = 0;
+int late_first = 0;
+int mirror_calls = 0;
+int mirror_last = 0;
+int count_last = 0;
+
+static int cb_value(p_cb_data cb_data) {
+    TEST_CHECK_EQ(cb_data->value->format, vpiIntVal);
+    return cb_data->value->value.integer;
+}
+
+static vpiHandle register_value_cb(PLI_INT32 (*cb_rtn)(p_cb_data), vpiHandle objp) {
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    t_cb_data cb_data;
+    bzero(&cb_data, sizeof(cb_data));
+    cb_data.cb_rtn = cb_rtn;
+    cb_data.reason = cbValueChange;
+    cb_data.obj = objp;
+    cb_data.value = &v;
+    vpiHandle const cbp = vpi_register_cb(&cb_data);
+    TEST_CHECK_NZ(cbp);
+    return cbp;
+}
+
+static int a_callback(p_cb_data cb_data) {
+    ++a_calls;
+    count_last = cb_value(cb_data);
+    TEST_CHECK_EQ(count_last, a_calls);
+    return 0;
+}
+
+static int shared_callback(p_cb_data cb_data) {
+    // Registered on the same handle as a_callback
+    ++shared_calls;
+    TEST_CHECK_EQ(cb_value(cb_data), shared_calls);
+    return 0;
+}
+
+static int mirror_put_callback(p_cb_data cb_data) {
+    // Copy count to mirror; mirror_callback, registered later, must see it in this pass
+    TestVpiHandle vh_mirror = VPI_HANDLE("mirror");
+    TEST_CHECK_NZ(vh_mirror);
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    v.value.integer = cb_value(cb_data);
+    vpi_put_value(vh_mirror, &v, nullptr, vpiNoDelay);
+    return 0;
+}
+
+static int remover_callback(p_cb_data cb_data) {
+    if (cb_value(cb_data) == 3) {
+        // victim_callback is later in this scan, it must not be called
+        TEST_CHECK_EQ(vpi_remove_cb(vh_victim_cb), 1);
+        vh_victim_cb.freed();
+    }
+    return 0;
+}
+
+static int victim_callback(p_cb_data cb_data) {
+    ++victim_calls;
+    TEST_CHECK_EQ(cb_value(cb_data), victim_calls);
+    return 0;
+}
+
+static int self_callback(p_cb_data cb_data) {
+    ++self_calls;
+    if (self_calls == 4) {
+        TEST_CHECK_EQ(vpi_remove_cb(vh_self_cb), 1);
+        vh_self_cb.freed();
+    }
+    return 0;
+}
+
+static int late_callback(p_cb_data cb_data) {
+    if (!late_calls) late_first = cb_value(cb_data);
+    ++late_calls;
+    return 0;
+}
+
+static int adder_callback(p_cb_data cb_data) {
+    // Added during this scan, so first called on the next change
+    if (cb_value(cb_data) == 5) vh_late_cb = register_value_cb(late_callback, vh_count);
+    return 0;
+}
+
+static int mirror_callback(p_cb_data cb_data) {
+    ++mirror_calls;
+    mirror_last = cb_value(cb_data);
+    TEST_CHECK_EQ(mirror_last, count_last);
+    return 0;
+}
+
+double sc_time_stamp() { return main_time; }
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+
+    uint64_t sim_time = 100;
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+
+    vh_count = VPI_HANDLE("count");
+    TEST_CHECK_NZ(vh_count);
+    TestVpiHandle vh_mirror = VPI_HANDLE("mirror");
+    TEST_CHECK_NZ(vh_mirror);
+
+    // Registration order is scan order
+    TestVpiHandle vh_a_cb = register_value_cb(a_callback, vh_count);
+    TestVpiHandle vh_shared_cb = register_value_cb(shared_callback, vh_count);
+    TestVpiHandle vh_mirror_put_cb = register_value_cb(mirror_put_callback, vh_count);
+    TestVpiHandle vh_remover_cb = register_value_cb(remover_callback, vh_count);
+    vh_victim_cb = register_value_cb(victim_callback, vh_count);
+    vh_self_cb = register_value_cb(self_callback, vh_count);
+    TestVpiHandle vh_adder_cb = register_value_cb(adder_callback, vh_count);
+    TestVpiHandle vh_mirror_cb = register_value_cb(mirror_callback, vh_mirror);
+
+    topp->eval();
+    topp->clk = 0;
+
+    while (main_time < sim_time && !contextp->gotFinish()) {
+        main_time += 1;
+        topp->clk = !topp->clk;
+        topp->eval();
+        VerilatedVpi::callValueCbs();
+        if (errors) vl_stop(__FILE__, __LINE__, "TOP-cpp");
+    }
+
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+
+    TEST_CHECK_EQ(a_calls, 11);  // Changes to 1..11, the last on the $finish edge
+    TEST_CHECK_EQ(shared_calls, a_calls);
+    TEST_CHECK_EQ(victim_calls, 2);
+    TEST_CHECK_EQ(self_calls, 4);
+    TEST_CHECK_EQ(late_first, 6);
+    TEST_CHECK_EQ(late_calls, a_calls - 5);
+    TEST_CHECK_EQ(mirror_calls, a_calls);
+    TEST_CHECK_EQ(mirror_last, a_calls);
+
+    topp->final();
+
+    return errors ? 10 : 0;
+}
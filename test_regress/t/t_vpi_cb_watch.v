@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain.
+// SPDX-FileCopyrightText: 2026 Wilson Snyder
+// SPDX-License-Identifier: CC0-1.0
+
+module t (  /*AUTOARG*/
+    // Inputs
+    input clk
+);
+
+  reg [31:0] count  /*verilator public_flat_rd */;
+  reg [31:0] mirror  /*verilator public_flat_rw */;  // Only written through VPI
+
+  initial begin
+    count = 0;
+    mirror = 0;
+  end
+
+  always @(posedge clk) begin
+    count <= count + 1;
+
+    if (count == 10) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule : t
@@ -47,5 +47,6 @@ test.compile(
 test.execute()
 
 test.file_grep(test.stats, r'Verilate jobs: (\d+)', 2)
+test.file_grep(test.stats, r'Stage, CPU time \(sec\), TOTAL\s+[0-9.]+')
 
 test.passes()